@@ -1831,6 +1831,32 @@ OcImageLoaderLoad (
   OUT EFI_HANDLE                *ImageHandle
   );
 
+/**
+  Same as OcImageLoaderLoad, but for images loaded twice in a row from the same
+  unmodified buffer. The first call keeps a copy of the relocated image, which
+  the second call rebases to its own pages instead of loading the file again.
+  Any other call to this function drops the kept copy.
+
+  @param[in]   BootPolicy        Ignored.
+  @param[in]   ParentImageHandle The caller's image handle.
+  @param[in]   DevicePath        Ignored.
+  @param[in]   SourceBuffer      Pointer to the memory location containing image to be loaded.
+  @param[in]   SourceSize        The size in bytes of SourceBuffer.
+  @param[out]  ImageHandle       The pointer to the returned image handle created on success.
+
+  @retval EFI_SUCCESS on success.
+**/
+EFI_STATUS
+EFIAPI
+OcImageLoaderLoadCached (
+  IN  BOOLEAN                   BootPolicy,
+  IN  EFI_HANDLE                ParentImageHandle,
+  IN  EFI_DEVICE_PATH_PROTOCOL  *DevicePath,
+  IN  VOID                      *SourceBuffer OPTIONAL,
+  IN  UINTN                     SourceSize,
+  OUT EFI_HANDLE                *ImageHandle
+  );
+
 /**
   Parse loaded image protocol load options, resultant options are in the
   same format as is returned by OcParsedVars and may be examined using the
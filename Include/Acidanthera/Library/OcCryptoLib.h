@@ -55,6 +55,12 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 #define SHA512_BLOCK_SIZE  128
 #define SHA384_BLOCK_SIZE  SHA512_BLOCK_SIZE
 
+//
+// Number of messages Sha256Multi may hash in parallel.
+// Larger batches are processed in groups of this size.
+//
+#define SHA256_MULTI_LANES  4
+
 //
 // Derived parameters.
 //
@@ -136,6 +142,12 @@ typedef struct SHA256_CONTEXT_ {
   UINT32    State[8];
 } SHA256_CONTEXT;
 
+typedef struct SHA256_MULTI_MESSAGE_ {
+  CONST UINT8    *Data;
+  UINTN          Length;
+  UINT8          Hash[SHA256_DIGEST_SIZE];
+} SHA256_MULTI_MESSAGE;
+
 typedef struct SHA512_CONTEXT_ {
   UINT64    TotalLength;
   UINTN     Length;
@@ -269,6 +281,21 @@ ChaChaCryptBuffer (
   IN     UINT32          Length
   );
 
+/**
+  Generate ChaCha keystream, i.e. encrypt zeroes.
+  Large requests are computed several blocks at once when possible.
+
+  @param[in,out] Context     ChaCha context.
+  @param[out]    Destination Resulting keystream.
+  @param[in]     Length      Keystream length.
+**/
+VOID
+ChaChaGenerateKeystream (
+  IN OUT CHACHA_CONTEXT  *Context,
+  OUT    UINT8           *Destination,
+  IN     UINT32          Length
+  );
+
 VOID
 Md5Init (
   MD5_CONTEXT  *Context
@@ -344,6 +371,19 @@ Sha256 (
   UINTN        Len
   );
 
+/**
+  Calculate SHA-256 digests of multiple independent messages.
+  Messages of similar length are hashed in parallel when the CPU allows.
+
+  @param[in,out] Messages  Messages to hash, Hash field receives the digest.
+  @param[in]     Count     Number of messages.
+**/
+VOID
+Sha256Multi (
+  IN OUT SHA256_MULTI_MESSAGE  *Messages,
+  IN     UINTN                 Count
+  );
+
 VOID
 Sha512Init (
   SHA512_CONTEXT  *Context
@@ -429,10 +469,10 @@ SigVerifyShaHashBySize (
                           RSA_MOD_MAX_SIZE.
 **/
 #define RSA_SCRATCH_BUFFER_SIZE(ModulusSize) \
-  ((ModulusSize) * 3U)
+  ((ModulusSize) * 5U + sizeof (UINT64))
 
 STATIC_ASSERT (
-  RSA_MOD_MAX_SIZE <= MAX_UINTN / 3U,
+  RSA_MOD_MAX_SIZE <= (MAX_UINTN - sizeof (UINT64)) / 5U,
   "The definition of RSA_SCRATCH_BUFFER_SIZE may cause an overflow"
   );
 
@@ -446,7 +486,7 @@ STATIC_ASSERT (
   @param[in] Hash           The Hash digest of the signed data.
   @param[in] HashSize       Size, in bytes, of Hash.
   @param[in] Algorithm      The RSA algorithm used.
-  @param[in] Scratch        Scratch buffer 3xModulo.
+  @param[in] Scratch        Scratch buffer RSA_SCRATCH_BUFFER_SIZE(Modulo).
 
   @returns  Whether the signature has been successfully verified as valid.
 
@@ -502,7 +542,7 @@ RsaVerifySigHashFromKeyDynalloc (
   @param[in] Data           The signed data to verify.
   @param[in] DataSize       Size, in bytes, of Data.
   @param[in] Algorithm      The RSA algorithm used.
-  @param[in] Scratch        Scratch buffer 3xModulo.
+  @param[in] Scratch        Scratch buffer RSA_SCRATCH_BUFFER_SIZE(Modulo).
 
   @returns  Whether the signature has been successfully verified as valid.
 
@@ -137,6 +137,47 @@ OcFileExists (
   IN    CONST CHAR16             *FileName
   );
 
+/**
+  Start caching OcFileExistsCached results, e.g. for the duration of
+  a boot entry scan. Calls may nest, each must be paired with
+  OcFileExistsCacheEnd.
+**/
+VOID
+OcFileExistsCacheBegin (
+  VOID
+  );
+
+/**
+  Stop caching OcFileExistsCached results and drop all cached results
+  once the outermost OcFileExistsCacheBegin call is ended.
+**/
+VOID
+OcFileExistsCacheEnd (
+  VOID
+  );
+
+/**
+  Report existence of file relative to source file's location, reusing
+  the result of an earlier probe of the same path on the same device
+  while caching is active.
+
+  @param  Device     Device handle of the volume, results are not cached if NULL.
+  @param  Prefix     Directory name of Directory relative to the volume root,
+                     NULL when Directory is the volume root.
+  @param  Directory  File protocol instance of parent directory.
+  @param  FileName   Null-terminated file name or relative path.
+
+  @retval EFI_SUCCESS when file exists.
+  @retval other       Error opening the file.
+**/
+EFI_STATUS
+OcFileExistsCached (
+  IN       EFI_HANDLE         Device    OPTIONAL,
+  IN CONST CHAR16             *Prefix   OPTIONAL,
+  IN CONST EFI_FILE_PROTOCOL  *Directory,
+  IN CONST CHAR16             *FileName
+  );
+
 /**
   Delete child file relative to source file's location.
 
@@ -211,6 +252,9 @@ OcReadFileSize (
 
 /**
   Read exact amount of bytes from EFI_FILE_PROTOCOL at specified position.
+  Large reads start with a 2 MB probe read both at once and in 1 MB slices,
+  the rest is read with a single Read call when both match and in 1 MB slices
+  otherwise. After any mismatch all reads are done in 1 MB slices.
 
   @param[in]  File         A pointer to the file protocol.
   @param[in]  Position     Position to read data from.
@@ -227,6 +271,27 @@ OcGetFileData (
   OUT UINT8              *Buffer
   );
 
+/**
+  Read exact amount of bytes from EFI_FILE_PROTOCOL at specified position
+  directly into previously allocated pages, e.g. a RAM disk extent.
+  Destinations above 4 GB are read through a bounce buffer in lower memory,
+  as several firmware drivers fail to read to high addresses.
+
+  @param[in]  File         A pointer to the file protocol.
+  @param[in]  Position     Position to read data from.
+  @param[in]  Size         The size of the data read.
+  @param[out] Buffer       A pointer to previously allocated pages to read data to.
+
+  @retval EFI_SUCCESS on success.
+**/
+EFI_STATUS
+OcGetFileDataToPages (
+  IN  EFI_FILE_PROTOCOL  *File,
+  IN  UINT64             Position,
+  IN  UINTN              Size,
+  OUT UINT8              *Buffer
+  );
+
 /**
   Write exact amount of bytes to a newly created file in EFI_FILE_PROTOCOL.
   Please note, that several filesystems (or drivers) may limit file name length.
@@ -132,6 +132,30 @@ XmlDocumentParse (
   IN      BOOLEAN  WithRefs
   );
 
+/**
+  Parse the XML fragment in buffer preserving a copy of the original contents.
+  Nodes which are not modified after parsing, including their descendants,
+  are exported verbatim from the preserved copy, so that export cost depends
+  on the amount of changes rather than the document size.
+
+  @param[in,out]  Buffer  Chunk to be parsed.
+  @param[in]      Length  Size of the buffer.
+  @param[in]      WithRef TRUE to enable reference lookup support.
+
+  @warning `Buffer` will be referenced by the document, it may not be freed
+           until XML_DOCUMENT is freed.
+  @warning XmlDocumentFree should be called after completion.
+  @warning `Buffer` contents are permanently modified during parsing
+
+  @return The parsed xml fragment or NULL.
+**/
+XML_DOCUMENT *
+XmlDocumentParseWithSource (
+  IN OUT  CHAR8    *Buffer,
+  IN      UINT32   Length,
+  IN      BOOLEAN  WithRefs
+  );
+
 /**
   Export parsed document into the buffer.
 
@@ -150,6 +174,46 @@ XmlDocumentExport (
   IN   BOOLEAN             PrependPlistInfo
   );
 
+/**
+  Compute the exact size of the exported document without performing the export.
+
+  @param[in]  Document          XML_DOCUMENT to export.
+  @param[out] Length            Resulting length of the export without trailing '\0'.
+  @param[in]  Skip              Number of root levels to be skipped before exporting, normally 0.
+  @param[in]  PrependPlistInfo  TRUE to prepend XML plist doc info to exported document.
+
+  @return TRUE on success, FALSE when the size does not fit.
+**/
+BOOLEAN
+XmlDocumentExportSize (
+  IN   CONST XML_DOCUMENT  *Document,
+  OUT  UINT32              *Length,
+  IN   UINT32              Skip,
+  IN   BOOLEAN             PrependPlistInfo
+  );
+
+/**
+  Export parsed document into the caller-provided buffer.
+
+  @param[in]  Document          XML_DOCUMENT to export.
+  @param[out] Buffer            Destination buffer.
+  @param[in]  BufferSize        Destination buffer size, must include space for trailing '\0'.
+  @param[out] Length            Resulting length of the export without trailing '\0'. Optional.
+  @param[in]  Skip              Number of root levels to be skipped before exporting, normally 0.
+  @param[in]  PrependPlistInfo  TRUE to prepend XML plist doc info to exported document.
+
+  @return TRUE on success, FALSE when the buffer is too small.
+**/
+BOOLEAN
+XmlDocumentExportToBuffer (
+  IN   CONST XML_DOCUMENT  *Document,
+  OUT  CHAR8               *Buffer,
+  IN   UINT32              BufferSize,
+  OUT  UINT32              *Length  OPTIONAL,
+  IN   UINT32              Skip,
+  IN   BOOLEAN             PrependPlistInfo
+  );
+
 /**
   Free all resources associated with the document. All XML_NODE
   references obtained through the document will be invalidated.
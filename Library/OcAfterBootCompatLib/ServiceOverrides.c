@@ -942,7 +942,7 @@ InternalEfiBootRtGetKcgOffset (
   // must be loaded with the OpenCore image loader as it is not signed. This is
   // not a security issue as it is implicitly signed via EfiBoot.
   //
-  Status = OcImageLoaderLoad (
+  Status = OcImageLoaderLoadCached (
              FALSE,
              gImageHandle,
              DevicePath,
@@ -1084,7 +1084,7 @@ OcLoadImage (
                                      );
   }
 
-  LoadImageStatus = OcImageLoaderLoad (
+  LoadImageStatus = OcImageLoaderLoadCached (
                       BootPolicy,
                       ParentImageHandle,
                       DevicePath,
@@ -0,0 +1,140 @@
+/** @file
+  Copyright (C) 2020, vit9696. All rights reserved.
+
+  All rights reserved.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+**/
+
+#include "OcApfsInternal.h"
+#include <Library/BaseLib.h>
+#include <Library/DebugLib.h>
+
+//
+// Number of interleaved partial sums. Each lane is an independent
+// dependency chain, which lets the compiler keep them in vector registers.
+//
+#define APFS_FLETCHER_LANES  4U
+
+UINT64
+InternalApfsFletcher64 (
+  IN CONST VOID  *Data,
+  IN UINTN       DataSize
+  )
+{
+  CONST UINT32  *Walker;
+  CONST UINT32  *WalkerEnd;
+  CONST UINT32  *LaneEnd;
+  UINT64        LaneSum1[APFS_FLETCHER_LANES];
+  UINT64        LaneSum2[APFS_FLETCHER_LANES];
+  UINT64        Sum1;
+  UINT64        Sum2;
+  UINT32        Rem;
+  UINT32        Index;
+
+  //
+  // For APFS we have the following guarantees (checked outside).
+  // - DataSize is always divisible by 4 (UINT32), the only potential exceptions
+  //   are multiples of block sizes of 1 and 2, which we do not support and filter out.
+  // - DataSize is always between 0x1000-8 and 0x10000-8, i.e. within UINT16.
+  //
+  ASSERT (DataSize >= APFS_NX_MINIMUM_BLOCK_SIZE - sizeof (UINT64));
+  ASSERT (DataSize <= APFS_NX_MAXIMUM_BLOCK_SIZE - sizeof (UINT64));
+  ASSERT (DataSize % sizeof (UINT32) == 0);
+
+  for (Index = 0; Index < APFS_FLETCHER_LANES; ++Index) {
+    LaneSum1[Index] = 0;
+    LaneSum2[Index] = 0;
+  }
+
+  Walker    = Data;
+  WalkerEnd = Walker + DataSize / sizeof (UINT32);
+  LaneEnd   = Walker + (DataSize / sizeof (UINT32)) / APFS_FLETCHER_LANES * APFS_FLETCHER_LANES;
+
+  //
+  // Word i of N contributes Data[i] to Sum1 and (N - i) * Data[i] to Sum2.
+  // Lane j sums every APFS_FLETCHER_LANES-th word starting with word j,
+  // so after M rounds LaneSum2[j] holds (M - k) * Data[k * LANES + j].
+  // Lanes never overflow, as their bounds are below the scalar ones.
+  //
+  while (Walker < LaneEnd) {
+    for (Index = 0; Index < APFS_FLETCHER_LANES; ++Index) {
+      LaneSum1[Index] += Walker[Index];
+      LaneSum2[Index] += LaneSum1[Index];
+    }
+
+    Walker += APFS_FLETCHER_LANES;
+  }
+
+  //
+  // Combine the lanes: (N - i) = LANES * (M - k) - j for i = k * LANES + j.
+  //
+  Sum1 = 0;
+  Sum2 = 0;
+  for (Index = 0; Index < APFS_FLETCHER_LANES; ++Index) {
+    Sum1 += LaneSum1[Index];
+    Sum2 += APFS_FLETCHER_LANES * LaneSum2[Index] - Index * LaneSum1[Index];
+  }
+
+  //
+  // Do usual Fletcher-64 rounds for the remaining words.
+  //
+  while (Walker < WalkerEnd) {
+    //
+    // Sum1 never overflows, because 0xFFFFFFFF * (0x10000-8) < MAX_UINT64.
+    // This is just a normal sum of data values.
+    //
+    Sum1 += *Walker;
+    //
+    // Sum2 never overflows, because 0xFFFFFFFF * (0x4000-1) * 0x1FFF < MAX_UINT64.
+    // This is just a normal arithmetical progression of sums.
+    //
+    Sum2 += Sum1;
+    ++Walker;
+  }
+
+  //
+  // Split Fletcher-64 halves.
+  // As per Chinese remainder theorem, perform the modulo now.
+  // No overflows also possible as seen from Sum1/Sum2 upper bounds above.
+  //
+
+  Sum2 += Sum1;
+  APFS_MOD_MAX_UINT32 (Sum2, &Rem);
+  Sum2 = ~Rem;
+
+  Sum1 += Sum2;
+  APFS_MOD_MAX_UINT32 (Sum1, &Rem);
+  Sum1 = ~Rem;
+
+  return (Sum1 << 32U) | Sum2;
+}
+
+BOOLEAN
+InternalApfsBlockChecksumVerify (
+  IN APFS_OBJ_PHYS  *Block,
+  IN UINTN          DataSize
+  )
+{
+  UINT64  NewChecksum;
+
+  ASSERT (DataSize > sizeof (*Block));
+
+  NewChecksum = InternalApfsFletcher64 (
+                  &Block->ObjectOid,
+                  DataSize - sizeof (Block->Checksum)
+                  );
+
+  if (NewChecksum == Block->Checksum) {
+    return TRUE;
+  }
+
+  DEBUG ((DEBUG_INFO, "OCJS: Checksum mismatch for %Lx\n", Block->ObjectOid));
+  return FALSE;
+}
@@ -14,6 +14,7 @@
 
 #include "OcApfsInternal.h"
 #include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/OcApfsLib.h>
@@ -21,6 +22,7 @@
 #include <Library/OcAppleSecureBootLib.h>
 #include <Library/OcBootManagementLib.h>
 #include <Library/OcConsoleLib.h>
+#include <Library/OcCryptoLib.h>
 #include <Library/OcDriverConnectionLib.h>
 #include <Library/OcGuardLib.h>
 #include <Library/UefiBootServicesTableLib.h>
@@ -40,6 +42,14 @@ STATIC BOOLEAN           mGlobalConnect;
 STATIC BOOLEAN           mDisconnectHandles;
 STATIC EFI_SYSTEM_TABLE  *mNullSystemTable;
 
+//
+// Digests of drivers started during this boot. Containers normally carry
+// the same apfs.efi, which needs to be loaded and started only once.
+//
+#define APFS_STARTED_DRIVERS_MAX  4
+STATIC UINT8  mApfsStartedDrivers[APFS_STARTED_DRIVERS_MAX][SHA256_DIGEST_SIZE];
+STATIC UINTN  mApfsStartedDriverCount;
+
 //
 // There seems to exist a driver with a very large version, which is treated by
 // apfs kernel extension to have 0 version. Follow suit.
@@ -231,6 +241,48 @@ ApfsRegisterPartition (
   return EFI_SUCCESS;
 }
 
+STATIC
+VOID
+ApfsConnectController (
+  IN APFS_PRIVATE_DATA  *PrivateData
+  )
+{
+  DEBUG ((
+    DEBUG_INFO,
+    "OCJS: Connecting %a%a APFS driver on handle %p\n",
+    mGlobalConnect ? "globally" : "normally",
+    mDisconnectHandles ? " with disconnection" : "",
+    PrivateData->LocationInfo.ControllerHandle
+    ));
+
+  if (mDisconnectHandles) {
+    //
+    // Unblock handles as some types of firmware, such as that on the HP EliteBook 840 G2,
+    // may automatically lock all volumes without filesystem drivers upon
+    // any attempt to connect them.
+    // REF: https://github.com/acidanthera/bugtracker/issues/1128
+    //
+    OcDisconnectDriversOnHandle (PrivateData->LocationInfo.ControllerHandle);
+  }
+
+  if (mGlobalConnect) {
+    //
+    // Connect all devices when implicitly requested. This is a workaround
+    // for some older HP laptops, which for some reason fail to connect by both
+    // drive and partition handles.
+    // REF: https://github.com/acidanthera/bugtracker/issues/960
+    //
+    OcConnectDrivers ();
+  } else {
+    //
+    // Recursively connect controller to get apfs.efi loaded.
+    // We cannot use apfs.efi handle as it apparently creates new handles.
+    // This follows ApfsJumpStart driver implementation.
+    //
+    gBS->ConnectController (PrivateData->LocationInfo.ControllerHandle, NULL, NULL, TRUE);
+  }
+}
+
 STATIC
 EFI_STATUS
 ApfsStartDriver (
@@ -356,40 +408,7 @@ ApfsStartDriver (
     return Status;
   }
 
-  DEBUG ((
-    DEBUG_INFO,
-    "OCJS: Connecting %a%a APFS driver on handle %p\n",
-    mGlobalConnect ? "globally" : "normally",
-    mDisconnectHandles ? " with disconnection" : "",
-    PrivateData->LocationInfo.ControllerHandle
-    ));
-
-  if (mDisconnectHandles) {
-    //
-    // Unblock handles as some types of firmware, such as that on the HP EliteBook 840 G2,
-    // may automatically lock all volumes without filesystem drivers upon
-    // any attempt to connect them.
-    // REF: https://github.com/acidanthera/bugtracker/issues/1128
-    //
-    OcDisconnectDriversOnHandle (PrivateData->LocationInfo.ControllerHandle);
-  }
-
-  if (mGlobalConnect) {
-    //
-    // Connect all devices when implicitly requested. This is a workaround
-    // for some older HP laptops, which for some reason fail to connect by both
-    // drive and partition handles.
-    // REF: https://github.com/acidanthera/bugtracker/issues/960
-    //
-    OcConnectDrivers ();
-  } else {
-    //
-    // Recursively connect controller to get apfs.efi loaded.
-    // We cannot use apfs.efi handle as it apparently creates new handles.
-    // This follows ApfsJumpStart driver implementation.
-    //
-    gBS->ConnectController (PrivateData->LocationInfo.ControllerHandle, NULL, NULL, TRUE);
-  }
+  ApfsConnectController (PrivateData);
 
   return EFI_SUCCESS;
 }
@@ -406,6 +425,8 @@ ApfsConnectDevice (
   APFS_PRIVATE_DATA   *PrivateData;
   VOID                *DriverBuffer;
   UINT32              DriverSize;
+  UINT8               DriverHash[SHA256_DIGEST_SIZE];
+  UINTN               Index;
 
   //
   // This may still be not APFS but some other file system.
@@ -439,8 +460,32 @@ ApfsConnectDevice (
     return Status;
   }
 
+  //
+  // An identical driver was already verified and started, it can bind
+  // to this container just like with global connection.
+  //
+  Sha256 (DriverHash, DriverBuffer, DriverSize);
+  for (Index = 0; Index < mApfsStartedDriverCount; ++Index) {
+    if (CompareMem (mApfsStartedDrivers[Index], DriverHash, sizeof (DriverHash)) == 0) {
+      DEBUG ((
+        DEBUG_INFO,
+        "OCJS: Reusing started APFS driver for %g\n",
+        &PrivateData->LocationInfo.ContainerUuid
+        ));
+      FreePool (DriverBuffer);
+      ApfsConnectController (PrivateData);
+      return EFI_SUCCESS;
+    }
+  }
+
   Status = ApfsStartDriver (PrivateData, DriverBuffer, DriverSize);
   FreePool (DriverBuffer);
+
+  if (!EFI_ERROR (Status) && (mApfsStartedDriverCount < APFS_STARTED_DRIVERS_MAX)) {
+    CopyMem (mApfsStartedDrivers[mApfsStartedDriverCount], DriverHash, sizeof (DriverHash));
+    ++mApfsStartedDriverCount;
+  }
+
   return Status;
 }
 
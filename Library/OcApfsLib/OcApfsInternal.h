@@ -98,6 +98,34 @@ typedef struct APFS_PRIVATE_DATA_ {
 **/
 extern LIST_ENTRY  mApfsPrivateDataList;
 
+/**
+  Compute APFS object checksum (Fletcher-64).
+
+  @param[in] Data      Object data following the checksum field.
+  @param[in] DataSize  Object data size, multiple of 4 bytes.
+
+  @return Fletcher-64 checksum.
+**/
+UINT64
+InternalApfsFletcher64 (
+  IN CONST VOID  *Data,
+  IN UINTN       DataSize
+  );
+
+/**
+  Verify APFS object checksum.
+
+  @param[in] Block     APFS object of DataSize bytes.
+  @param[in] DataSize  Object size, normally APFS block size.
+
+  @retval TRUE on checksum match.
+**/
+BOOLEAN
+InternalApfsBlockChecksumVerify (
+  IN APFS_OBJ_PHYS  *Block,
+  IN UINTN          DataSize
+  );
+
 EFI_STATUS
 InternalApfsReadSuperBlock (
   IN  EFI_BLOCK_IO_PROTOCOL  *BlockIo,
@@ -21,93 +21,6 @@
 #include <Library/OcGuardLib.h>
 #include <Library/OcPeCoffLib.h>
 
-STATIC
-UINT64
-ApfsFletcher64 (
-  VOID   *Data,
-  UINTN  DataSize
-  )
-{
-  UINT32  *Walker;
-  UINT32  *WalkerEnd;
-  UINT64  Sum1;
-  UINT64  Sum2;
-  UINT32  Rem;
-
-  //
-  // For APFS we have the following guarantees (checked outside).
-  // - DataSize is always divisible by 4 (UINT32), the only potential exceptions
-  //   are multiples of block sizes of 1 and 2, which we do not support and filter out.
-  // - DataSize is always between 0x1000-8 and 0x10000-8, i.e. within UINT16.
-  //
-  ASSERT (DataSize >= APFS_NX_MINIMUM_BLOCK_SIZE - sizeof (UINT64));
-  ASSERT (DataSize <= APFS_NX_MAXIMUM_BLOCK_SIZE - sizeof (UINT64));
-  ASSERT (DataSize % sizeof (UINT32) == 0);
-
-  Sum1 = 0;
-  Sum2 = 0;
-
-  Walker    = Data;
-  WalkerEnd = Walker + DataSize / sizeof (UINT32);
-
-  //
-  // Do usual Fletcher-64 rounds without modulo due to impossible overflow.
-  //
-  while (Walker < WalkerEnd) {
-    //
-    // Sum1 never overflows, because 0xFFFFFFFF * (0x10000-8) < MAX_UINT64.
-    // This is just a normal sum of data values.
-    //
-    Sum1 += *Walker;
-    //
-    // Sum2 never overflows, because 0xFFFFFFFF * (0x4000-1) * 0x1FFF < MAX_UINT64.
-    // This is just a normal arithmetical progression of sums.
-    //
-    Sum2 += Sum1;
-    ++Walker;
-  }
-
-  //
-  // Split Fletcher-64 halves.
-  // As per Chinese remainder theorem, perform the modulo now.
-  // No overflows also possible as seen from Sum1/Sum2 upper bounds above.
-  //
-
-  Sum2 += Sum1;
-  APFS_MOD_MAX_UINT32 (Sum2, &Rem);
-  Sum2 = ~Rem;
-
-  Sum1 += Sum2;
-  APFS_MOD_MAX_UINT32 (Sum1, &Rem);
-  Sum1 = ~Rem;
-
-  return (Sum1 << 32U) | Sum2;
-}
-
-STATIC
-BOOLEAN
-ApfsBlockChecksumVerify (
-  APFS_OBJ_PHYS  *Block,
-  UINTN          DataSize
-  )
-{
-  UINT64  NewChecksum;
-
-  ASSERT (DataSize > sizeof (*Block));
-
-  NewChecksum = ApfsFletcher64 (
-                  &Block->ObjectOid,
-                  DataSize - sizeof (Block->Checksum)
-                  );
-
-  if (NewChecksum == Block->Checksum) {
-    return TRUE;
-  }
-
-  DEBUG ((DEBUG_INFO, "OCJS: Checksum mismatch for %Lx\n", Block->ObjectOid));
-  return FALSE;
-}
-
 STATIC
 EFI_STATUS
 ApfsReadJumpStart (
@@ -181,7 +94,7 @@ ApfsReadJumpStart (
   //
   // Calculate and verify checksum.
   //
-  if (!ApfsBlockChecksumVerify (&JumpStart->BlockHeader, PrivateData->ApfsBlockSize)) {
+  if (!InternalApfsBlockChecksumVerify (&JumpStart->BlockHeader, PrivateData->ApfsBlockSize)) {
     FreePool (JumpStart);
     return EFI_UNSUPPORTED;
   }
@@ -367,7 +280,7 @@ InternalApfsReadSuperBlock (
     //
     // Calculate and verify checksum.
     //
-    if (!ApfsBlockChecksumVerify (&SuperBlock->BlockHeader, SuperBlock->BlockSize)) {
+    if (!InternalApfsBlockChecksumVerify (&SuperBlock->BlockHeader, SuperBlock->BlockSize)) {
       break;
     }
 
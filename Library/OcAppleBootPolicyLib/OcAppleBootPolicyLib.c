@@ -137,41 +137,6 @@ STATIC APPLE_BOOT_POLICY_PROTOCOL  mAppleBootPolicyProtocol = {
   BootPolicyGetAllApfsRecoveryFilePath
 };
 
-/**
-  Checks whether the given file exists or not.
-
-  @param[in] Root      The volume's opened root.
-  @param[in] FileName  The path of the file to check.
-
-  @return  Returned is whether the specified file exists or not.
-
-**/
-STATIC
-EFI_STATUS
-InternalFileExists (
-  IN EFI_FILE_HANDLE  Root,
-  IN CONST CHAR16     *FileName
-  )
-{
-  EFI_STATUS       Status;
-  EFI_FILE_HANDLE  FileHandle;
-
-  Status = OcSafeFileOpen (
-             Root,
-             &FileHandle,
-             FileName,
-             EFI_FILE_MODE_READ,
-             0
-             );
-
-  if (!EFI_ERROR (Status)) {
-    FileHandle->Close (FileHandle);
-    return EFI_SUCCESS;
-  }
-
-  return Status;
-}
-
 STATIC
 EFI_STATUS
 InternalGetApfsSpecialFileInfo (
@@ -350,7 +315,7 @@ InternalGetBooterFromBlessedSystemFolderPath (
     return Status;
   }
 
-  Status = InternalFileExists (Root, BooterPath);
+  Status = OcFileExistsCached (Device, NULL, Root, BooterPath);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_BULK_INFO, "OCBP: Blessed folder %s is missing - %r\n", BooterPath, Status));
     return EFI_NOT_FOUND;
@@ -387,7 +352,9 @@ OcGetBooterFromPredefinedPathList (
       ASSERT (PathName[0] == L'\\');
     }
 
-    Status = InternalFileExists (
+    Status = OcFileExistsCached (
+               Device,
+               Prefix,
                Root,
                Prefix != NULL ? &PathName[1] : &PathName[0]
                );
@@ -138,12 +138,16 @@ OcAppleChunklistVerifyData (
   BOOLEAN  Result;
 
   UINTN                        Index;
-  UINT8                        ChunkHash[SHA256_DIGEST_SIZE];
+  UINTN                        Lane;
+  UINTN                        Lanes;
+  UINTN                        MaxLanes;
+  SHA256_MULTI_MESSAGE         Messages[SHA256_MULTI_LANES];
   CONST APPLE_CHUNKLIST_CHUNK  *CurrentChunk;
   UINTN                        CurrentOffset;
+  UINTN                        BufferSize;
 
   UINT32  ChunkDataSize;
-  VOID    *ChunkData;
+  UINT8   *ChunkData;
 
   ASSERT (Context != NULL);
   ASSERT (Context->Chunks != NULL);
@@ -161,24 +165,46 @@ OcAppleChunklistVerifyData (
     }
   }
 
-  ChunkData = AllocatePool (ChunkDataSize);
+  //
+  // Chunks are hashed in batches of SHA256_MULTI_LANES when there is enough
+  // memory to hold them, otherwise one at a time.
+  //
+  MaxLanes  = SHA256_MULTI_LANES;
+  ChunkData = NULL;
+  if (!OcOverflowMulUN (ChunkDataSize, MaxLanes, &BufferSize)) {
+    ChunkData = AllocatePool (BufferSize);
+  }
+
   if (ChunkData == NULL) {
-    return FALSE;
+    MaxLanes  = 1;
+    ChunkData = AllocatePool (ChunkDataSize);
+    if (ChunkData == NULL) {
+      return FALSE;
+    }
   }
 
   CurrentOffset = 0;
-  for (Index = 0; Index < Context->ChunkCount; Index++) {
-    CurrentChunk = &Context->Chunks[Index];
-
-    Result = OcAppleRamDiskRead (
-               ExtentTable,
-               CurrentOffset,
-               CurrentChunk->Length,
-               ChunkData
-               );
-    if (!Result) {
-      FreePool (ChunkData);
-      return FALSE;
+  for (Index = 0; Index < Context->ChunkCount; Index += Lanes) {
+    Lanes = MIN (Context->ChunkCount - Index, MaxLanes);
+
+    for (Lane = 0; Lane < Lanes; ++Lane) {
+      CurrentChunk = &Context->Chunks[Index + Lane];
+
+      Messages[Lane].Data   = ChunkData + Lane * ChunkDataSize;
+      Messages[Lane].Length = CurrentChunk->Length;
+
+      Result = OcAppleRamDiskRead (
+                 ExtentTable,
+                 CurrentOffset,
+                 CurrentChunk->Length,
+                 ChunkData + Lane * ChunkDataSize
+                 );
+      if (!Result) {
+        FreePool (ChunkData);
+        return FALSE;
+      }
+
+      CurrentOffset += CurrentChunk->Length;
     }
 
     //
@@ -186,17 +212,19 @@ OcAppleChunklistVerifyData (
     //
     DEBUG ((
       DEBUG_VERBOSE,
-      "OCCL: Validating chunk %lu of %lu\n",
+      "OCCL: Validating chunks %lu-%lu of %lu\n",
       (UINT64)Index + 1,
+      (UINT64)(Index + Lanes),
       (UINT64)Context->ChunkCount
       ));
-    Sha256 (ChunkHash, ChunkData, CurrentChunk->Length);
-    if (CompareMem (ChunkHash, CurrentChunk->Checksum, SHA256_DIGEST_SIZE) != 0) {
-      FreePool (ChunkData);
-      return FALSE;
-    }
+    Sha256Multi (Messages, Lanes);
 
-    CurrentOffset += CurrentChunk->Length;
+    for (Lane = 0; Lane < Lanes; ++Lane) {
+      if (CompareMem (Messages[Lane].Hash, Context->Chunks[Index + Lane].Checksum, SHA256_DIGEST_SIZE) != 0) {
+        FreePool (ChunkData);
+        return FALSE;
+      }
+    }
   }
 
   FreePool (ChunkData);
@@ -70,6 +70,22 @@ STATIC BOOLEAN  mHasDigestOverride;
 STATIC UINT8    mOriginalDigest[SHA384_DIGEST_SIZE];
 STATIC UINT8    mOverrideDigest[SHA384_DIGEST_SIZE];
 
+//
+// Manifests already verified during this boot, as the same manifest is
+// commonly checked several times, e.g. by OpenCore and then by boot.efi.
+//
+#define OC_IMG4_MANIFEST_CACHE_SIZE  8U
+
+typedef struct {
+  UINT32                 ObjType;
+  UINT8                  ManifestDigest[SHA384_DIGEST_SIZE];
+  DERImg4ManifestInfo    ManInfo;
+} OC_IMG4_MANIFEST_CACHE_ENTRY;
+
+STATIC OC_IMG4_MANIFEST_CACHE_ENTRY  mManifestCache[OC_IMG4_MANIFEST_CACHE_SIZE];
+STATIC UINTN                         mManifestCacheCount;
+STATIC UINTN                         mManifestCacheNext;
+
 STATIC
 OC_SB_MODEL_DESC *
 InternalGetModelInfo (
@@ -108,6 +124,72 @@ InternalGetModelInfo (
   return NULL;
 }
 
+/**
+  Verify and parse the IMG4 Manifest like DERImg4ParseManifest, reusing the
+  result of a previous verification of the same Manifest and object type.
+  Only the manifest signature and contents are cached, the object digest and
+  environment are still checked by the caller.
+
+  @param[out] ManInfo         Output Manifest information structure.
+  @param[in]  ManifestBuffer  Buffer containing the Manifest data.
+  @param[in]  ManifestSize    Size, in bytes, of ManifestBuffer.
+  @param[in]  ObjType         The object type to inspect.
+
+  @retval DR_Success  The Manifest is valid and ManInfo has been returned.
+  @retval other       An error has occured.
+**/
+STATIC
+DERReturn
+InternalParseManifestCached (
+  OUT DERImg4ManifestInfo  *ManInfo,
+  IN  CONST VOID           *ManifestBuffer,
+  IN  UINTN                ManifestSize,
+  IN  UINT32               ObjType
+  )
+{
+  DERReturn                     DerResult;
+  UINT8                         ManifestDigest[SHA384_DIGEST_SIZE];
+  UINTN                         Index;
+  OC_IMG4_MANIFEST_CACHE_ENTRY  *Entry;
+
+  Sha384 (ManifestDigest, ManifestBuffer, ManifestSize);
+
+  for (Index = 0; Index < mManifestCacheCount; ++Index) {
+    Entry = &mManifestCache[Index];
+    if (  (Entry->ObjType == ObjType)
+       && (CompareMem (Entry->ManifestDigest, ManifestDigest, sizeof (ManifestDigest)) == 0))
+    {
+      CopyMem (ManInfo, &Entry->ManInfo, sizeof (*ManInfo));
+      return DR_Success;
+    }
+  }
+
+  DerResult = DERImg4ParseManifest (
+                ManInfo,
+                ManifestBuffer,
+                ManifestSize,
+                ObjType
+                );
+  if (DerResult != DR_Success) {
+    return DerResult;
+  }
+
+  //
+  // Replace the oldest entry once the cache is full.
+  //
+  Entry          = &mManifestCache[mManifestCacheNext];
+  Entry->ObjType = ObjType;
+  CopyMem (Entry->ManifestDigest, ManifestDigest, sizeof (Entry->ManifestDigest));
+  CopyMem (&Entry->ManInfo, ManInfo, sizeof (Entry->ManInfo));
+
+  mManifestCacheNext = (mManifestCacheNext + 1) % ARRAY_SIZE (mManifestCache);
+  if (mManifestCacheCount < ARRAY_SIZE (mManifestCache)) {
+    ++mManifestCacheCount;
+  }
+
+  return DR_Success;
+}
+
 bool
 DERImg4VerifySignature (
   DERByte        *Modulus,
@@ -197,7 +279,7 @@ OcAppleImg4Verify (
     return EFI_INVALID_PARAMETER;
   }
 
-  DerResult = DERImg4ParseManifest (
+  DerResult = InternalParseManifestCached (
                 &ManInfo,
                 ManifestBuffer,
                 ManifestSize,
@@ -417,30 +417,87 @@ KcInitKextFixupChains (
 }
 
 /*
-  Indexes RelocInfo into the fixup chains SegChain of Segment.
+  Returns the offset of RelocInfo within the KEXTs segment.
 
-  @param[in,out] Context      Prelinked context.
-  @param[in]     MachContext  The context of the Mach-O RelocInfo belongs to. It
-                              must have been prelinked by OcAppleKernelLib. The
-                              image must reside in Segment.
-  @param[in]     RelocInfo    The relocation to add a fixup of.
-  @param[in]     RelocBase    The relocation base address.
+  @param[in] Context    Prelinked context.
+  @param[in] RelocInfo  The relocation to get the offset of.
+  @param[in] RelocBase  The relocation base address.
+*/
+STATIC
+UINT32
+InternalKcGetRelocOffsetInSeg (
+  IN CONST PRELINKED_CONTEXT     *Context,
+  IN CONST MACH_RELOCATION_INFO  *RelocInfo,
+  IN UINT64                      RelocBase
+  )
+{
+  UINT64  RelocAddress;
+
+  ASSERT (Context != NULL);
+  ASSERT (RelocInfo != NULL);
+  //
+  // The entire KEXT and thus its relocations must be in Segment.
+  // Mach-O images are limited to 4 GB size by OcMachoLib, so the cast is safe.
+  //
+  RelocAddress = RelocBase + (UINT32)RelocInfo->Address;
+  //
+  // For now we assume we prelinked already and the relocations are sane.
+  //
+  ASSERT (RelocInfo->Extern == 0);
+  ASSERT (RelocInfo->Type == MachX8664RelocUnsigned);
+  ASSERT (RelocAddress >= Context->KextsVmAddress);
+
+  return (UINT32)(RelocAddress - Context->KextsVmAddress);
+}
+
+/*
+  Sorts relocation offsets in descending order.
+*/
+STATIC
+INTN
+EFIAPI
+InternalKcCompareRelocOffsets (
+  IN CONST VOID  *Buffer1,
+  IN CONST VOID  *Buffer2
+  )
+{
+  UINT32  Offset1;
+  UINT32  Offset2;
+
+  Offset1 = *(CONST UINT32 *)Buffer1;
+  Offset2 = *(CONST UINT32 *)Buffer2;
+
+  if (Offset1 > Offset2) {
+    return -1;
+  }
+
+  if (Offset1 < Offset2) {
+    return 1;
+  }
+
+  return 0;
+}
+
+/*
+  Indexes the relocation at RelocOffsetInSeg into the fixup chains of the
+  KEXTs segment. Indexing relocations in descending order per page always
+  prepends the new fixup to the chain, which does not require chain walking.
+
+  @param[in,out] Context           Prelinked context.
+  @param[in]     RelocOffsetInSeg  The offset of the relocation to add a fixup
+                                   of within the KEXTs segment.
 */
 STATIC
 VOID
 InternalKcConvertRelocToFixup (
-  IN OUT PRELINKED_CONTEXT           *Context,
-  IN     OC_MACHO_CONTEXT            *MachContext,
-  IN     CONST MACH_RELOCATION_INFO  *RelocInfo,
-  IN     UINT64                      RelocBase
+  IN OUT PRELINKED_CONTEXT  *Context,
+  IN     UINT32             RelocOffsetInSeg
   )
 {
   UINT8  *SegmentData;
   UINT8  *SegmentPageData;
 
-  UINT64  RelocAddress;
-  UINT32  RelocOffsetInSeg;
-  VOID    *RelocDest;
+  VOID  *RelocDest;
 
   UINT16                                        NewFixupPage;
   UINT16                                        NewFixupPageOffset;
@@ -454,23 +511,9 @@ InternalKcConvertRelocToFixup (
   UINT16  FixupDelta;
 
   ASSERT (Context != NULL);
-  ASSERT (MachContext != NULL);
-  ASSERT (RelocInfo != NULL);
 
   ASSERT (Context->KextsFixupChains != NULL);
   ASSERT (Context->KextsFixupChains->PageSize == MACHO_PAGE_SIZE);
-  //
-  // The entire KEXT and thus its relocations must be in Segment.
-  // Mach-O images are limited to 4 GB size by OcMachoLib, so the cast is safe.
-  //
-  RelocAddress     = RelocBase + (UINT32)RelocInfo->Address;
-  RelocOffsetInSeg = (UINT32)(RelocAddress - Context->KextsVmAddress);
-  //
-  // For now we assume we prelinked already and the relocations are sane.
-  //
-  ASSERT (RelocInfo->Extern == 0);
-  ASSERT (RelocInfo->Type == MachX8664RelocUnsigned);
-  ASSERT (RelocAddress >= Context->KextsVmAddress);
   ASSERT (RelocOffsetInSeg <= Context->PrelinkedSize - Context->KextsFileOffset);
   ASSERT (Context->KextsFileOffset - RelocOffsetInSeg >= 8);
   //
@@ -513,8 +556,7 @@ InternalKcConvertRelocToFixup (
     SegmentPageData = SegmentData + NewFixupPage * MACHO_PAGE_SIZE;
     //
     // Find the last fixup of this page that preceeds RelocInfo.
-    // FIXME: Consider sorting the relocations in descending order first to
-    //        then always prepend the new fixup.
+    // This only happens when relocations are not sorted in descending order.
     //
     NextIterFixupPageOffset = IterFixupPageOffset;
     do {
@@ -567,6 +609,8 @@ KcKextIndexFixups (
   CONST MACH_RELOCATION_INFO     *Relocations;
   VOID                           *FileData;
   UINT32                         RelocIndex;
+  UINT32                         *RelocOffsets;
+  UINT32                         TmpRelocOffset;
 
   ASSERT (Context != NULL);
   ASSERT (MachContext != NULL);
@@ -629,14 +673,50 @@ KcKextIndexFixups (
     FirstSegment->VirtualAddress
     ));
 
+  if (DySymtab->NumOfLocalRelocations == 0) {
+    return;
+  }
+
+  //
+  // Sort the relocations in descending order first to always prepend the new
+  // fixup to its page chain, building each chain in a single linear pass.
+  //
+  RelocOffsets = AllocatePool (DySymtab->NumOfLocalRelocations * sizeof (*RelocOffsets));
+  if (RelocOffsets == NULL) {
+    //
+    // Chain walking handles any relocation order, just slower.
+    //
+    for (RelocIndex = 0; RelocIndex < DySymtab->NumOfLocalRelocations; ++RelocIndex) {
+      InternalKcConvertRelocToFixup (
+        Context,
+        InternalKcGetRelocOffsetInSeg (Context, &Relocations[RelocIndex], FirstSegment->VirtualAddress)
+        );
+    }
+
+    return;
+  }
+
   for (RelocIndex = 0; RelocIndex < DySymtab->NumOfLocalRelocations; ++RelocIndex) {
-    InternalKcConvertRelocToFixup (
-      Context,
-      MachContext,
-      &Relocations[RelocIndex],
-      FirstSegment->VirtualAddress
-      );
+    RelocOffsets[RelocIndex] = InternalKcGetRelocOffsetInSeg (
+                                 Context,
+                                 &Relocations[RelocIndex],
+                                 FirstSegment->VirtualAddress
+                                 );
   }
+
+  QuickSort (
+    RelocOffsets,
+    DySymtab->NumOfLocalRelocations,
+    sizeof (*RelocOffsets),
+    InternalKcCompareRelocOffsets,
+    &TmpRelocOffset
+    );
+
+  for (RelocIndex = 0; RelocIndex < DySymtab->NumOfLocalRelocations; ++RelocIndex) {
+    InternalKcConvertRelocToFixup (Context, RelocOffsets[RelocIndex]);
+  }
+
+  FreePool (RelocOffsets);
 }
 
 UINT32
@@ -353,7 +353,10 @@ PrelinkedContextInit (
     return EFI_OUT_OF_RESOURCES;
   }
 
-  Context->PrelinkedInfoDocument = XmlDocumentParse (
+  //
+  // Preserve original plist contents to only re-serialise modified kexts on export.
+  //
+  Context->PrelinkedInfoDocument = XmlDocumentParseWithSource (
                                      Context->PrelinkedInfo,
                                      (UINT32)(Context->Is32Bit ?
                                               Context->PrelinkedInfoSection->Section32.Size : Context->PrelinkedInfoSection->Section64.Size),
@@ -793,8 +796,11 @@ PrelinkedInjectComplete (
     }
   }
 
-  ExportedInfo = XmlDocumentExport (Context->PrelinkedInfoDocument, &ExportedInfoSize, 0, FALSE);
-  if (ExportedInfo == NULL) {
+  //
+  // Compute the exact plist size first and export it directly into
+  // the prelinked image to avoid intermediate allocations and copies.
+  //
+  if (!XmlDocumentExportSize (Context->PrelinkedInfoDocument, &ExportedInfoSize, 0, FALSE)) {
     return EFI_OUT_OF_RESOURCES;
   }
 
@@ -806,7 +812,6 @@ PrelinkedInjectComplete (
   if (  OcOverflowAddU32 (Context->PrelinkedSize, MACHO_ALIGN (ExportedInfoSize), &NewSize)
      || (NewSize > Context->PrelinkedAllocSize))
   {
-    FreePool (ExportedInfo);
     return EFI_BUFFER_TOO_SMALL;
   }
 
@@ -816,24 +821,31 @@ PrelinkedInjectComplete (
   // This requires disable __KREMLIN relocation segment addition.
   //
   if (Context->IsKernelCollection && (MACHO_ALIGN (ExportedInfoSize) <= Context->PrelinkedInfoSegment->Size)) {
-    CopyMem (
-      &Context->Prelinked[Context->PrelinkedInfoSegment->FileOffset],
-      ExportedInfo,
-      ExportedInfoSize
-      );
+    ExportedInfo = (CHAR8 *)&Context->Prelinked[Context->PrelinkedInfoSegment->FileOffset];
+    if (!XmlDocumentExportToBuffer (Context->PrelinkedInfoDocument, ExportedInfo, ExportedInfoSize, NULL, 0, FALSE)) {
+      return EFI_INVALID_PARAMETER;
+    }
 
     ZeroMem (
       &Context->Prelinked[Context->PrelinkedInfoSegment->FileOffset + ExportedInfoSize],
       Context->PrelinkedInfoSegment->FileSize - ExportedInfoSize
       );
 
-    FreePool (ExportedInfo);
-
     return EFI_SUCCESS;
   }
 
  #endif
 
+  ExportedInfo = (CHAR8 *)&Context->Prelinked[Context->PrelinkedSize];
+  if (!XmlDocumentExportToBuffer (Context->PrelinkedInfoDocument, ExportedInfo, ExportedInfoSize, NULL, 0, FALSE)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  ZeroMem (
+    &Context->Prelinked[Context->PrelinkedSize + ExportedInfoSize],
+    MACHO_ALIGN (ExportedInfoSize) - ExportedInfoSize
+    );
+
   if (Context->Is32Bit) {
     Context->PrelinkedInfoSegment->Segment32.VirtualAddress = (UINT32)Context->PrelinkedLastAddress;
     Context->PrelinkedInfoSegment->Segment32.Size           = MACHO_ALIGN (ExportedInfoSize);
@@ -866,17 +878,6 @@ PrelinkedInjectComplete (
     Context->InnerInfoSection->Offset         = Context->PrelinkedSize;
   }
 
-  CopyMem (
-    &Context->Prelinked[Context->PrelinkedSize],
-    ExportedInfo,
-    ExportedInfoSize
-    );
-
-  ZeroMem (
-    &Context->Prelinked[Context->PrelinkedSize + ExportedInfoSize],
-    MACHO_ALIGN (ExportedInfoSize) - ExportedInfoSize
-    );
-
   Context->PrelinkedLastAddress += MACHO_ALIGN (ExportedInfoSize);
   Context->PrelinkedSize        += MACHO_ALIGN (ExportedInfoSize);
 
@@ -478,12 +478,9 @@ OcAppleRamDiskLoadFile (
   EFI_STATUS      Status;
   UINT64          FilePosition;
   UINT32          Index;
-  UINTN           RequestedSize;
   UINTN           ReadSize;
-  UINTN           ExtentSize;
   SHA256_CONTEXT  Ctx;
   UINT8           Digest[SHA256_DIGEST_SIZE];
-  UINT8           *TmpBuffer;
   UINT8           *ExtentBuffer;
 
   ASSERT (ExtentTable != NULL);
@@ -491,17 +488,6 @@ OcAppleRamDiskLoadFile (
   ASSERT (File != NULL);
   ASSERT (FileSize > 0);
 
-  //
-  // We need a temporary buffer in lower addresses as several motherboards on APTIO IV,
-  // e.g. GA-Z77P-D3 (rev. 1.1), GA-Z87X-UD4H, etc. fail to read directly to high addresses
-  // when using FAT filesystem. The original workaround to this was AvoidHighAlloc quirk.
-  // REF: https://github.com/acidanthera/bugtracker/issues/449
-  //
-  TmpBuffer = AllocatePool (BASE_4MB);
-  if (TmpBuffer == NULL) {
-    return FALSE;
-  }
-
   DEBUG_CODE_BEGIN ();
   Sha256Init (&Ctx);
   DEBUG_CODE_END ();
@@ -513,42 +499,25 @@ OcAppleRamDiskLoadFile (
     ASSERT (ExtentTable->Extents[Index].Length <= MAX_UINTN);
 
     ExtentBuffer = (VOID *)(UINTN)ExtentTable->Extents[Index].Start;
-    ExtentSize   = (UINTN)ExtentTable->Extents[Index].Length;
-
-    while (FileSize > 0 && ExtentSize > 0) {
-      Status = File->SetPosition (File, FilePosition);
-      if (EFI_ERROR (Status)) {
-        FreePool (TmpBuffer);
-        return FALSE;
-      }
+    ReadSize     = MIN (FileSize, (UINTN)ExtentTable->Extents[Index].Length);
 
-      RequestedSize = MIN (MIN (BASE_4MB, FileSize), ExtentSize);
-      ReadSize      = RequestedSize;
-      Status        = File->Read (
-                              File,
-                              &ReadSize,
-                              TmpBuffer
-                              );
-      if (EFI_ERROR (Status) || (RequestedSize != ReadSize)) {
-        FreePool (TmpBuffer);
-        return FALSE;
-      }
-
-      DEBUG_CODE_BEGIN ();
-      Sha256Update (&Ctx, TmpBuffer, ReadSize);
-      DEBUG_CODE_END ();
+    //
+    // Read straight into the extent, OcGetFileDataToPages bounces
+    // through lower memory for firmware unable to read to high addresses.
+    //
+    Status = OcGetFileDataToPages (File, FilePosition, ReadSize, ExtentBuffer);
+    if (EFI_ERROR (Status)) {
+      return FALSE;
+    }
 
-      CopyMem (ExtentBuffer, TmpBuffer, ReadSize);
+    DEBUG_CODE_BEGIN ();
+    Sha256Update (&Ctx, ExtentBuffer, ReadSize);
+    DEBUG_CODE_END ();
 
-      FilePosition += ReadSize;
-      ExtentBuffer += ReadSize;
-      ExtentSize   -= ReadSize;
-      FileSize     -= ReadSize;
-    }
+    FilePosition += ReadSize;
+    FileSize     -= ReadSize;
   }
 
-  FreePool (TmpBuffer);
-
   //
   // Not enough extents.
   //
@@ -614,8 +614,175 @@ InternalAddAppleVersion (
   return NewFlavour;
 }
 
+//
+// Boot entry descriptions are remembered for the lifetime of the image,
+// so that reentering the picker does not reread labels, flavours and
+// SystemVersion.plist files of every entry. Entries are keyed by their
+// device path, which includes the partition GUID and the booter path.
+//
+#define OC_BOOT_DESCRIPTION_CACHE_MAX  64
+
+typedef struct {
+  LIST_ENTRY                  Link;
+  EFI_DEVICE_PATH_PROTOCOL    *DevicePath;
+  OC_BOOT_ENTRY_TYPE          EntryType;
+  BOOLEAN                     IsGeneric;
+  BOOLEAN                     UseFlavourIcon;
+  OC_BOOT_ENTRY_TYPE          Type;
+  BOOLEAN                     IsAppleInstaller;
+  CHAR16                      *Name;
+  CHAR16                      *PathName;
+  CHAR8                       *Flavour;
+} OC_BOOT_DESCRIPTION_CACHE_ENTRY;
+
+STATIC LIST_ENTRY  mBootDescriptionCache = INITIALIZE_LIST_HEAD_VARIABLE (mBootDescriptionCache);
+STATIC UINTN       mBootDescriptionCacheCount;
+
+STATIC
+VOID
+InternalFreeBootDescription (
+  IN OC_BOOT_DESCRIPTION_CACHE_ENTRY  *Entry
+  )
+{
+  if (Entry->DevicePath != NULL) {
+    FreePool (Entry->DevicePath);
+  }
+
+  if (Entry->Name != NULL) {
+    FreePool (Entry->Name);
+  }
+
+  if (Entry->PathName != NULL) {
+    FreePool (Entry->PathName);
+  }
+
+  if (Entry->Flavour != NULL) {
+    FreePool (Entry->Flavour);
+  }
+
+  FreePool (Entry);
+}
+
+STATIC
+OC_BOOT_DESCRIPTION_CACHE_ENTRY *
+InternalLookupBootDescription (
+  IN CONST OC_BOOT_ENTRY  *BootEntry,
+  IN       BOOLEAN        UseFlavourIcon
+  )
+{
+  LIST_ENTRY                       *Link;
+  OC_BOOT_DESCRIPTION_CACHE_ENTRY  *Entry;
+
+  for (
+       Link = GetFirstNode (&mBootDescriptionCache);
+       !IsNull (&mBootDescriptionCache, Link);
+       Link = GetNextNode (&mBootDescriptionCache, Link))
+  {
+    Entry = BASE_CR (Link, OC_BOOT_DESCRIPTION_CACHE_ENTRY, Link);
+    if (  (Entry->EntryType == BootEntry->Type)
+       && (Entry->IsGeneric == BootEntry->IsGeneric)
+       && (Entry->UseFlavourIcon == UseFlavourIcon)
+       && IsDevicePathEqual (Entry->DevicePath, BootEntry->DevicePath))
+    {
+      return Entry;
+    }
+  }
+
+  return NULL;
+}
+
+STATIC
 EFI_STATUS
-InternalDescribeBootEntry (
+InternalRestoreBootDescription (
+  IN     CONST OC_BOOT_DESCRIPTION_CACHE_ENTRY  *Entry,
+  IN OUT       OC_BOOT_ENTRY                    *BootEntry
+  )
+{
+  ASSERT (Entry->Name != NULL);
+  ASSERT (Entry->PathName != NULL);
+
+  BootEntry->Name     = AllocateCopyPool (StrSize (Entry->Name), Entry->Name);
+  BootEntry->PathName = AllocateCopyPool (StrSize (Entry->PathName), Entry->PathName);
+  if (Entry->Flavour != NULL) {
+    BootEntry->Flavour = AllocateCopyPool (AsciiStrSize (Entry->Flavour), Entry->Flavour);
+  }
+
+  if (  (BootEntry->Name == NULL)
+     || (BootEntry->PathName == NULL)
+     || ((Entry->Flavour != NULL) && (BootEntry->Flavour == NULL)))
+  {
+    if (BootEntry->Name != NULL) {
+      FreePool (BootEntry->Name);
+      BootEntry->Name = NULL;
+    }
+
+    if (BootEntry->PathName != NULL) {
+      FreePool (BootEntry->PathName);
+      BootEntry->PathName = NULL;
+    }
+
+    if (BootEntry->Flavour != NULL) {
+      FreePool (BootEntry->Flavour);
+      BootEntry->Flavour = NULL;
+    }
+
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  BootEntry->Type             = Entry->Type;
+  BootEntry->IsAppleInstaller = Entry->IsAppleInstaller;
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+VOID
+InternalSaveBootDescription (
+  IN CONST OC_BOOT_ENTRY       *BootEntry,
+  IN       OC_BOOT_ENTRY_TYPE  EntryType,
+  IN       BOOLEAN             UseFlavourIcon
+  )
+{
+  OC_BOOT_DESCRIPTION_CACHE_ENTRY  *Entry;
+
+  if (mBootDescriptionCacheCount >= OC_BOOT_DESCRIPTION_CACHE_MAX) {
+    return;
+  }
+
+  Entry = AllocateZeroPool (sizeof (*Entry));
+  if (Entry == NULL) {
+    return;
+  }
+
+  Entry->DevicePath = DuplicateDevicePath (BootEntry->DevicePath);
+  Entry->Name       = AllocateCopyPool (StrSize (BootEntry->Name), BootEntry->Name);
+  Entry->PathName   = AllocateCopyPool (StrSize (BootEntry->PathName), BootEntry->PathName);
+  if (BootEntry->Flavour != NULL) {
+    Entry->Flavour = AllocateCopyPool (AsciiStrSize (BootEntry->Flavour), BootEntry->Flavour);
+  }
+
+  if (  (Entry->DevicePath == NULL)
+     || (Entry->Name == NULL)
+     || (Entry->PathName == NULL)
+     || ((BootEntry->Flavour != NULL) && (Entry->Flavour == NULL)))
+  {
+    InternalFreeBootDescription (Entry);
+    return;
+  }
+
+  Entry->EntryType        = EntryType;
+  Entry->IsGeneric        = BootEntry->IsGeneric;
+  Entry->UseFlavourIcon   = UseFlavourIcon;
+  Entry->Type             = BootEntry->Type;
+  Entry->IsAppleInstaller = BootEntry->IsAppleInstaller;
+
+  InsertTailList (&mBootDescriptionCache, &Entry->Link);
+  ++mBootDescriptionCacheCount;
+}
+
+STATIC
+EFI_STATUS
+InternalReadBootEntryDescription (
   IN     OC_BOOT_CONTEXT  *BootContext,
   IN OUT OC_BOOT_ENTRY    *BootEntry
   )
@@ -833,3 +1000,38 @@ InternalDescribeBootEntry (
 
   return EFI_SUCCESS;
 }
+
+EFI_STATUS
+InternalDescribeBootEntry (
+  IN     OC_BOOT_CONTEXT  *BootContext,
+  IN OUT OC_BOOT_ENTRY    *BootEntry
+  )
+{
+  EFI_STATUS                       Status;
+  OC_BOOT_ENTRY_TYPE               EntryType;
+  BOOLEAN                          UseFlavourIcon;
+  OC_BOOT_DESCRIPTION_CACHE_ENTRY  *Entry;
+
+  //
+  // Custom entries need no special description.
+  //
+  if ((BootEntry->Type == OC_BOOT_EXTERNAL_OS) || (BootEntry->Type == OC_BOOT_EXTERNAL_TOOL)) {
+    return EFI_SUCCESS;
+  }
+
+  EntryType      = BootEntry->Type;
+  UseFlavourIcon = (BootContext->PickerContext->PickerAttributes & OC_ATTR_USE_FLAVOUR_ICON) != 0;
+
+  Entry = InternalLookupBootDescription (BootEntry, UseFlavourIcon);
+  if (Entry != NULL) {
+    DEBUG ((DEBUG_INFO, "OCB: Using cached description %s for %s\n", Entry->Name, Entry->PathName));
+    return InternalRestoreBootDescription (Entry, BootEntry);
+  }
+
+  Status = InternalReadBootEntryDescription (BootContext, BootEntry);
+  if (!EFI_ERROR (Status)) {
+    InternalSaveBootDescription (BootEntry, EntryType, UseFlavourIcon);
+  }
+
+  return Status;
+}
@@ -1998,8 +1998,9 @@ OcSetDefaultBootRecovery (
   return EFI_NOT_FOUND;
 }
 
+STATIC
 OC_BOOT_CONTEXT *
-OcScanForBootEntries (
+InternalScanForBootEntries (
   IN  OC_PICKER_CONTEXT  *Context
   )
 {
@@ -2189,8 +2190,9 @@ OcScanForBootEntries (
   return BootContext;
 }
 
+STATIC
 OC_BOOT_CONTEXT *
-OcScanForDefaultBootEntry (
+InternalScanForDefaultBootEntry (
   IN  OC_PICKER_CONTEXT  *Context,
   IN  BOOLEAN            UseBootNextOnly
   )
@@ -2402,6 +2404,39 @@ OcScanForDefaultBootEntry (
   return BootContext;
 }
 
+OC_BOOT_CONTEXT *
+OcScanForBootEntries (
+  IN  OC_PICKER_CONTEXT  *Context
+  )
+{
+  OC_BOOT_CONTEXT  *BootContext;
+
+  //
+  // Predefined paths are probed on every file system, remember the results
+  // for the duration of the scan.
+  //
+  OcFileExistsCacheBegin ();
+  BootContext = InternalScanForBootEntries (Context);
+  OcFileExistsCacheEnd ();
+
+  return BootContext;
+}
+
+OC_BOOT_CONTEXT *
+OcScanForDefaultBootEntry (
+  IN  OC_PICKER_CONTEXT  *Context,
+  IN  BOOLEAN            UseBootNextOnly
+  )
+{
+  OC_BOOT_CONTEXT  *BootContext;
+
+  OcFileExistsCacheBegin ();
+  BootContext = InternalScanForDefaultBootEntry (Context, UseBootNextOnly);
+  OcFileExistsCacheEnd ();
+
+  return BootContext;
+}
+
 OC_BOOT_ENTRY  **
 OcEnumerateEntries (
   IN  OC_BOOT_CONTEXT  *BootContext
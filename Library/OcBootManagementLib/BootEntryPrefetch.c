@@ -0,0 +1,169 @@
+/** @file
+  Default boot entry prefetch during the picker countdown.
+
+  Boot services offer no threads, yet the picker spends most of the
+  countdown polling for keys. The loader of the default boot entry is
+  read in small steps from the key polling routine, so that booting it
+  once the countdown expires does not have to wait for slow media.
+  The data is dropped as soon as a different entry is chosen.
+
+  Copyright (c) 2023, Acidanthera. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-3-Clause
+**/
+
+#include "BootManagementInternal.h"
+
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/OcDebugLogLib.h>
+#include <Library/OcFileLib.h>
+
+//
+// Amount of data read per key poll, small enough not to delay key handling.
+//
+#define OC_BOOT_ENTRY_PREFETCH_STEP      SIZE_256KB
+#define OC_BOOT_ENTRY_PREFETCH_MAX_SIZE  BASE_64MB
+
+typedef struct {
+  OC_BOOT_ENTRY        *BootEntry;
+  EFI_FILE_PROTOCOL    *File;
+  UINT8                *Buffer;
+  UINT32               Size;
+  UINT32               Offset;
+} OC_BOOT_ENTRY_PREFETCH;
+
+STATIC OC_BOOT_ENTRY_PREFETCH  mBootEntryPrefetch;
+
+VOID
+InternalStartBootEntryPrefetch (
+  IN OC_BOOT_ENTRY  *BootEntry
+  )
+{
+  EFI_STATUS                Status;
+  EFI_DEVICE_PATH_PROTOCOL  *RemainingDevicePath;
+  EFI_FILE_PROTOCOL         *File;
+  UINT32                    Size;
+
+  ASSERT (BootEntry != NULL);
+
+  InternalCancelBootEntryPrefetch ();
+
+  //
+  // Only entries loaded straight from their device path are prefetched,
+  // tools and folders are read differently.
+  //
+  if (  ((BootEntry->Type & OC_BOOT_SYSTEM) != 0)
+     || (BootEntry->Type == OC_BOOT_EXTERNAL_TOOL)
+     || BootEntry->IsFolder
+     || (BootEntry->DevicePath == NULL))
+  {
+    return;
+  }
+
+  RemainingDevicePath = BootEntry->DevicePath;
+  Status              = OcOpenFileByDevicePath (
+                          &RemainingDevicePath,
+                          &File,
+                          EFI_FILE_MODE_READ,
+                          0
+                          );
+  if (EFI_ERROR (Status)) {
+    return;
+  }
+
+  Status = OcGetFileSize (File, &Size);
+  if (EFI_ERROR (Status) || (Size == 0) || (Size > OC_BOOT_ENTRY_PREFETCH_MAX_SIZE)) {
+    File->Close (File);
+    return;
+  }
+
+  mBootEntryPrefetch.Buffer = AllocatePool (Size);
+  if (mBootEntryPrefetch.Buffer == NULL) {
+    File->Close (File);
+    return;
+  }
+
+  mBootEntryPrefetch.BootEntry = BootEntry;
+  mBootEntryPrefetch.File      = File;
+  mBootEntryPrefetch.Size      = Size;
+  mBootEntryPrefetch.Offset    = 0;
+
+  DEBUG ((DEBUG_INFO, "OCB: Prefetching %u bytes of default entry %s\n", Size, BootEntry->Name));
+}
+
+VOID
+InternalStepBootEntryPrefetch (
+  VOID
+  )
+{
+  EFI_STATUS  Status;
+  UINT32      ReadSize;
+
+  if (mBootEntryPrefetch.File == NULL) {
+    return;
+  }
+
+  ReadSize = MIN (mBootEntryPrefetch.Size - mBootEntryPrefetch.Offset, OC_BOOT_ENTRY_PREFETCH_STEP);
+  Status   = OcGetFileData (
+               mBootEntryPrefetch.File,
+               mBootEntryPrefetch.Offset,
+               ReadSize,
+               mBootEntryPrefetch.Buffer + mBootEntryPrefetch.Offset
+               );
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_INFO, "OCB: Default entry prefetch failed - %r\n", Status));
+    InternalCancelBootEntryPrefetch ();
+    return;
+  }
+
+  mBootEntryPrefetch.Offset += ReadSize;
+
+  if (mBootEntryPrefetch.Offset == mBootEntryPrefetch.Size) {
+    mBootEntryPrefetch.File->Close (mBootEntryPrefetch.File);
+    mBootEntryPrefetch.File = NULL;
+    DEBUG ((DEBUG_INFO, "OCB: Default entry prefetch done\n"));
+  }
+}
+
+BOOLEAN
+InternalTakeBootEntryPrefetch (
+  IN  OC_BOOT_ENTRY  *BootEntry,
+  OUT VOID           **Data,
+  OUT UINT32         *DataSize
+  )
+{
+  ASSERT (BootEntry != NULL);
+  ASSERT (Data != NULL);
+  ASSERT (DataSize != NULL);
+
+  if (  (mBootEntryPrefetch.BootEntry != BootEntry)
+     || (mBootEntryPrefetch.File != NULL))
+  {
+    InternalCancelBootEntryPrefetch ();
+    return FALSE;
+  }
+
+  *Data     = mBootEntryPrefetch.Buffer;
+  *DataSize = mBootEntryPrefetch.Size;
+
+  ZeroMem (&mBootEntryPrefetch, sizeof (mBootEntryPrefetch));
+  return TRUE;
+}
+
+VOID
+InternalCancelBootEntryPrefetch (
+  VOID
+  )
+{
+  if (mBootEntryPrefetch.File != NULL) {
+    mBootEntryPrefetch.File->Close (mBootEntryPrefetch.File);
+  }
+
+  if (mBootEntryPrefetch.Buffer != NULL) {
+    FreePool (mBootEntryPrefetch.Buffer);
+  }
+
+  ZeroMem (&mBootEntryPrefetch, sizeof (mBootEntryPrefetch));
+}
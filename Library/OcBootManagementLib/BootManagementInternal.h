@@ -281,6 +281,50 @@ InternalGetOcEntryProtocolDevPath (
   IN CONST EFI_DEVICE_PATH_PROTOCOL  *DevicePath
   );
 
+/**
+  Start reading the loader of the default boot entry. The data is read in
+  small steps by InternalStepBootEntryPrefetch while the picker is idle.
+
+  @param[in]  BootEntry  Default boot entry.
+**/
+VOID
+InternalStartBootEntryPrefetch (
+  IN OC_BOOT_ENTRY  *BootEntry
+  );
+
+/**
+  Read the next part of the default boot entry loader, if any.
+**/
+VOID
+InternalStepBootEntryPrefetch (
+  VOID
+  );
+
+/**
+  Obtain the prefetched loader of a boot entry. The prefetch is dropped
+  when it was started for a different entry or is not complete yet.
+
+  @param[in]  BootEntry  Boot entry to be loaded.
+  @param[out] Data       Loader data, to be freed by the caller.
+  @param[out] DataSize   Size of loader data.
+
+  @retval TRUE when the loader data was prefetched.
+**/
+BOOLEAN
+InternalTakeBootEntryPrefetch (
+  IN  OC_BOOT_ENTRY  *BootEntry,
+  OUT VOID           **Data,
+  OUT UINT32         *DataSize
+  );
+
+/**
+  Drop any default boot entry prefetch.
+**/
+VOID
+InternalCancelBootEntryPrefetch (
+  VOID
+  );
+
 EFI_STATUS
 InternalRunRequestPrivilege (
   IN OC_PICKER_CONTEXT   *PickerContext,
@@ -1558,6 +1558,10 @@ InternalLoadBootEntry (
     }
   } else {
     DevicePath = BootEntry->DevicePath;
+    //
+    // Use the loader read during the picker countdown, if any.
+    //
+    InternalTakeBootEntryPrefetch (BootEntry, &EntryData, &EntryDataSize);
   }
 
   DEBUG_CODE_BEGIN ();
@@ -252,6 +252,12 @@ GetPickerKeyInfo (
   ASSERT (Context->HotKeyContext->DoNotRepeatContext != NULL);
   ASSERT (PickerKeyInfo                              != NULL);
 
+  //
+  // Both pickers poll for keys while idle, use this time to read ahead
+  // the default boot entry.
+  //
+  InternalStepBootEntryPrefetch ();
+
   PickerKeyInfo->OcKeyCode   = OC_INPUT_NO_ACTION;
   PickerKeyInfo->OcModifiers = OC_MODIFIERS_NONE;
   PickerKeyInfo->UnicodeChar = CHAR_NULL;
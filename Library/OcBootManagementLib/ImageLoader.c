@@ -81,6 +81,24 @@ STATIC BOOLEAN                    mImageLoaderEnabled;
 
 STATIC BOOLEAN  mProtectUefiServices;
 
+//
+// The image last loaded by OcImageLoaderLoadCached, kept until the next call.
+// Only the relocated image and its relocation data are kept, so that a second
+// instance can be copied to any address and rebased without parsing the file.
+//
+typedef struct {
+  CONST VOID                 *SourceBuffer;
+  VOID                       *ImageBuffer;
+  PE_COFF_RUNTIME_CONTEXT    *RelocationData;
+  EFI_PHYSICAL_ADDRESS       ImageArea;
+  UINT32                     SourceSize;
+  UINT32                     ImageSize;
+  UINT32                     AddressOfEntryPoint;
+  UINT16                     Subsystem;
+} OC_IMAGE_CACHE_ENTRY;
+
+STATIC OC_IMAGE_CACHE_ENTRY  mImageCache;
+
 STATIC EFI_IMAGE_LOAD          mPreservedLoadImage;
 STATIC EFI_IMAGE_START         mPreservedStartImage;
 STATIC EFI_EXIT_BOOT_SERVICES  mPreservedExitBootServices;
@@ -245,26 +263,230 @@ InternalUpdateLoadedImage (
   return EFI_SUCCESS;
 }
 
+/**
+  Drop the image kept by OcImageLoaderLoadCached.
+**/
+STATIC
+VOID
+InternalImageCacheFree (
+  VOID
+  )
+{
+  if (mImageCache.ImageBuffer != NULL) {
+    FreePool (mImageCache.ImageBuffer);
+  }
+
+  if (mImageCache.RelocationData != NULL) {
+    FreePool (mImageCache.RelocationData);
+  }
+
+  ZeroMem (&mImageCache, sizeof (mImageCache));
+}
+
+/**
+  Keep a freshly relocated image for the next OcImageLoaderLoadCached call.
+  The image must not have been started yet.
+
+  @param[in] SourceBuffer         The image file contents.
+  @param[in] SourceSize           The size, in bytes, of SourceBuffer.
+  @param[in] ImageArea            The address the image is relocated to.
+  @param[in] ImageSize            The size, in bytes, of the loaded image.
+  @param[in] AddressOfEntryPoint  The image entry point RVA.
+  @param[in] Subsystem            The image subsystem.
+  @param[in] RelocationData       The relocation data of the image, owned
+                                  by the cache on return.
+**/
+STATIC
+VOID
+InternalImageCacheInsert (
+  IN CONST VOID               *SourceBuffer,
+  IN UINT32                   SourceSize,
+  IN EFI_PHYSICAL_ADDRESS     ImageArea,
+  IN UINT32                   ImageSize,
+  IN UINT32                   AddressOfEntryPoint,
+  IN UINT16                   Subsystem,
+  IN PE_COFF_RUNTIME_CONTEXT  *RelocationData
+  )
+{
+  InternalImageCacheFree ();
+
+  mImageCache.ImageBuffer = AllocateCopyPool (ImageSize, (VOID *)(UINTN)ImageArea);
+  if (mImageCache.ImageBuffer == NULL) {
+    FreePool (RelocationData);
+    return;
+  }
+
+  mImageCache.SourceBuffer        = SourceBuffer;
+  mImageCache.RelocationData      = RelocationData;
+  mImageCache.ImageArea           = ImageArea;
+  mImageCache.SourceSize          = SourceSize;
+  mImageCache.ImageSize           = ImageSize;
+  mImageCache.AddressOfEntryPoint = AddressOfEntryPoint;
+  mImageCache.Subsystem           = Subsystem;
+}
+
+/**
+  Copy the kept image to newly allocated pages and rebase it there.
+
+  @param[out] DestinationArea  On success, the address of the restored image.
+
+  @retval EFI_SUCCESS  The image has been restored.
+  @retval other        The image could not be restored.
+**/
+STATIC
 EFI_STATUS
-EFIAPI
-OcImageLoaderLoad (
-  IN  BOOLEAN                   BootPolicy,
-  IN  EFI_HANDLE                ParentImageHandle,
-  IN  EFI_DEVICE_PATH_PROTOCOL  *DevicePath,
-  IN  VOID                      *SourceBuffer OPTIONAL,
-  IN  UINTN                     SourceSize,
-  OUT EFI_HANDLE                *ImageHandle
+InternalImageCacheRestore (
+  OUT EFI_PHYSICAL_ADDRESS  *DestinationArea
+  )
+{
+  EFI_STATUS     Status;
+  RETURN_STATUS  ImageStatus;
+  VOID           *DestinationBuffer;
+
+  Status = gBS->AllocatePages (
+                  AllocateAnyPages,
+                  mImageCache.Subsystem == EFI_IMAGE_SUBSYSTEM_EFI_APPLICATION
+      ? EfiLoaderCode : EfiBootServicesCode,
+                  EFI_SIZE_TO_PAGES (mImageCache.ImageSize),
+                  DestinationArea
+                  );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  DestinationBuffer = (VOID *)(UINTN)*DestinationArea;
+  CopyMem (DestinationBuffer, mImageCache.ImageBuffer, mImageCache.ImageSize);
+
+  //
+  // Runtime relocation applies the difference between BaseAddress and the
+  // buffer address, which must be the difference between the two areas.
+  //
+  ImageStatus = PeCoffRelocateImageForRuntime (
+                  DestinationBuffer,
+                  mImageCache.ImageSize,
+                  *DestinationArea + (*DestinationArea - mImageCache.ImageArea),
+                  mImageCache.RelocationData
+                  );
+  if (EFI_ERROR (ImageStatus)) {
+    DEBUG ((DEBUG_INFO, "OCB: PeCoff cached image rebase error - %r\n", ImageStatus));
+    FreePages (DestinationBuffer, EFI_SIZE_TO_PAGES (mImageCache.ImageSize));
+    return EFI_UNSUPPORTED;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Construct and install the LoadedImage protocols for a loaded image.
+
+  @param[in]  ParentImageHandle    The caller's image handle.
+  @param[in]  DestinationArea      The address of the loaded image.
+  @param[in]  ImageSize            The size, in bytes, of the loaded image.
+  @param[in]  AddressOfEntryPoint  The image entry point RVA.
+  @param[in]  Subsystem            The image subsystem.
+  @param[out] ImageHandle          On success, the handle of the image.
+
+  @retval EFI_SUCCESS  The protocols have been installed.
+  @retval other        The image handle could not be created.
+**/
+STATIC
+EFI_STATUS
+InternalInstallLoadedImage (
+  IN  EFI_HANDLE            ParentImageHandle,
+  IN  EFI_PHYSICAL_ADDRESS  DestinationArea,
+  IN  UINT32                ImageSize,
+  IN  UINT32                AddressOfEntryPoint,
+  IN  UINT16                Subsystem,
+  OUT EFI_HANDLE            *ImageHandle
   )
 {
   EFI_STATUS                 Status;
-  EFI_STATUS                 ImageStatus;
-  PE_COFF_IMAGE_CONTEXT      ImageContext;
-  EFI_PHYSICAL_ADDRESS       DestinationArea;
-  UINT32                     DestinationSize;
-  VOID                       *DestinationBuffer;
   OC_LOADED_IMAGE_PROTOCOL   *OcLoadedImage;
   EFI_LOADED_IMAGE_PROTOCOL  *LoadedImage;
 
+  //
+  // Construct a LoadedImage protocol for the image.
+  //
+  OcLoadedImage = AllocateZeroPool (sizeof (*OcLoadedImage));
+  if (OcLoadedImage == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  OcLoadedImage->EntryPoint = (EFI_IMAGE_ENTRY_POINT)((UINTN)DestinationArea + AddressOfEntryPoint);
+  OcLoadedImage->ImageArea  = DestinationArea;
+  OcLoadedImage->PageCount  = EFI_SIZE_TO_PAGES (ImageSize);
+  OcLoadedImage->Subsystem  = Subsystem;
+
+  LoadedImage = &OcLoadedImage->LoadedImage;
+
+  LoadedImage->Revision     = EFI_LOADED_IMAGE_INFORMATION_REVISION;
+  LoadedImage->ParentHandle = ParentImageHandle;
+  LoadedImage->SystemTable  = gST;
+  LoadedImage->ImageBase    = (VOID *)(UINTN)DestinationArea;
+  LoadedImage->ImageSize    = ImageSize;
+  //
+  // FIXME: Support RT drivers.
+  //
+  if (Subsystem == EFI_IMAGE_SUBSYSTEM_EFI_APPLICATION) {
+    LoadedImage->ImageCodeType = EfiLoaderCode;
+    LoadedImage->ImageDataType = EfiLoaderData;
+  } else {
+    LoadedImage->ImageCodeType = EfiBootServicesCode;
+    LoadedImage->ImageDataType = EfiBootServicesData;
+  }
+
+  //
+  // Install LoadedImage and the image's entry point.
+  //
+  *ImageHandle = NULL;
+  Status       = gBS->InstallMultipleProtocolInterfaces (
+                        ImageHandle,
+                        &gEfiLoadedImageProtocolGuid,
+                        LoadedImage,
+                        &mOcLoadedImageProtocolGuid,
+                        OcLoadedImage,
+                        NULL
+                        );
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_INFO, "OCB: PeCoff proto install error - %r\n", Status));
+    FreePool (OcLoadedImage);
+    return Status;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Load an image with the OpenCore image loader.
+
+  @param[in]  ParentImageHandle  The caller's image handle.
+  @param[in]  SourceBuffer       Pointer to the memory location containing image to be loaded.
+  @param[in]  SourceSize         The size in bytes of SourceBuffer.
+  @param[in]  UseCache           Whether to reuse the image kept by the previous
+                                 call, or keep this image for the next call.
+  @param[out] ImageHandle        The pointer to the returned image handle created on success.
+
+  @retval EFI_SUCCESS on success.
+**/
+STATIC
+EFI_STATUS
+InternalImageLoaderLoad (
+  IN  EFI_HANDLE  ParentImageHandle,
+  IN  VOID        *SourceBuffer,
+  IN  UINTN       SourceSize,
+  IN  BOOLEAN     UseCache,
+  OUT EFI_HANDLE  *ImageHandle
+  )
+{
+  EFI_STATUS               Status;
+  EFI_STATUS               ImageStatus;
+  PE_COFF_IMAGE_CONTEXT    ImageContext;
+  EFI_PHYSICAL_ADDRESS     DestinationArea;
+  UINT32                   DestinationSize;
+  VOID                     *DestinationBuffer;
+  PE_COFF_RUNTIME_CONTEXT  *RelocationData;
+  UINT32                   RelocationDataSize;
+
   ASSERT (SourceBuffer != NULL);
 
   //
@@ -274,6 +496,38 @@ OcImageLoaderLoad (
     return EFI_UNSUPPORTED;
   }
 
+  //
+  // The kept image is used at most once, as its caller is known to load
+  // the same unmodified buffer twice in a row.
+  //
+  if (UseCache && (mImageCache.ImageBuffer != NULL)) {
+    if (  (mImageCache.SourceBuffer == SourceBuffer)
+       && (mImageCache.SourceSize == SourceSize))
+    {
+      Status = InternalImageCacheRestore (&DestinationArea);
+      if (!EFI_ERROR (Status)) {
+        Status = InternalInstallLoadedImage (
+                   ParentImageHandle,
+                   DestinationArea,
+                   mImageCache.ImageSize,
+                   mImageCache.AddressOfEntryPoint,
+                   mImageCache.Subsystem,
+                   ImageHandle
+                   );
+        if (EFI_ERROR (Status)) {
+          FreePages ((VOID *)(UINTN)DestinationArea, EFI_SIZE_TO_PAGES (mImageCache.ImageSize));
+        } else {
+          DEBUG ((DEBUG_VERBOSE, "OCB: Loaded cached image at %p\n", *ImageHandle));
+        }
+
+        InternalImageCacheFree ();
+        return Status;
+      }
+    }
+
+    InternalImageCacheFree ();
+  }
+
   //
   // Initialize the image context.
   //
@@ -317,6 +571,23 @@ OcImageLoaderLoad (
     return RETURN_UNSUPPORTED;
   }
 
+  //
+  // Keep the relocation data of images loaded for the cache, so that
+  // the cached copy can be rebased to another address.
+  //
+  RelocationData     = NULL;
+  RelocationDataSize = 0;
+  if (UseCache && !ImageContext.RelocsStripped) {
+    ImageStatus = PeCoffRelocationDataSize (&ImageContext, &RelocationDataSize);
+    if (!EFI_ERROR (ImageStatus)) {
+      RelocationData = AllocatePool (RelocationDataSize);
+    }
+
+    if (RelocationData == NULL) {
+      RelocationDataSize = 0;
+    }
+  }
+
   //
   // Allocate the image destination memory.
   // FIXME: RT drivers require EfiRuntimeServicesCode.
@@ -329,6 +600,10 @@ OcImageLoaderLoad (
                   &DestinationArea
                   );
   if (EFI_ERROR (Status)) {
+    if (RelocationData != NULL) {
+      FreePool (RelocationData);
+    }
+
     return Status;
   }
 
@@ -345,6 +620,10 @@ OcImageLoaderLoad (
   if (EFI_ERROR (ImageStatus)) {
     DEBUG ((DEBUG_INFO, "OCB: PeCoff load image error - %r\n", ImageStatus));
     FreePages (DestinationBuffer, EFI_SIZE_TO_PAGES (ImageContext.SizeOfImage));
+    if (RelocationData != NULL) {
+      FreePool (RelocationData);
+    }
+
     return EFI_UNSUPPORTED;
   }
 
@@ -354,64 +633,46 @@ OcImageLoaderLoad (
   ImageStatus = PeCoffRelocateImage (
                   &ImageContext,
                   (UINTN)DestinationBuffer,
-                  NULL,
-                  0
+                  RelocationData,
+                  RelocationDataSize
                   );
   if (EFI_ERROR (ImageStatus)) {
     DEBUG ((DEBUG_INFO, "OCB: PeCoff relocate image error - %r\n", ImageStatus));
     FreePages (DestinationBuffer, EFI_SIZE_TO_PAGES (ImageContext.SizeOfImage));
+    if (RelocationData != NULL) {
+      FreePool (RelocationData);
+    }
+
     return EFI_UNSUPPORTED;
   }
 
-  //
-  // Construct a LoadedImage protocol for the image.
-  //
-  OcLoadedImage = AllocateZeroPool (sizeof (*OcLoadedImage));
-  if (OcLoadedImage == NULL) {
+  Status = InternalInstallLoadedImage (
+             ParentImageHandle,
+             DestinationArea,
+             ImageContext.SizeOfImage,
+             ImageContext.AddressOfEntryPoint,
+             ImageContext.Subsystem,
+             ImageHandle
+             );
+  if (EFI_ERROR (Status)) {
     FreePages (DestinationBuffer, EFI_SIZE_TO_PAGES (ImageContext.SizeOfImage));
-    return EFI_OUT_OF_RESOURCES;
-  }
-
-  OcLoadedImage->EntryPoint = (EFI_IMAGE_ENTRY_POINT)((UINTN)DestinationBuffer + ImageContext.AddressOfEntryPoint);
-  OcLoadedImage->ImageArea  = DestinationArea;
-  OcLoadedImage->PageCount  = EFI_SIZE_TO_PAGES (ImageContext.SizeOfImage);
-  OcLoadedImage->Subsystem  = ImageContext.Subsystem;
-
-  LoadedImage = &OcLoadedImage->LoadedImage;
+    if (RelocationData != NULL) {
+      FreePool (RelocationData);
+    }
 
-  LoadedImage->Revision     = EFI_LOADED_IMAGE_INFORMATION_REVISION;
-  LoadedImage->ParentHandle = ParentImageHandle;
-  LoadedImage->SystemTable  = gST;
-  LoadedImage->ImageBase    = DestinationBuffer;
-  LoadedImage->ImageSize    = ImageContext.SizeOfImage;
-  //
-  // FIXME: Support RT drivers.
-  //
-  if (ImageContext.Subsystem == EFI_IMAGE_SUBSYSTEM_EFI_APPLICATION) {
-    LoadedImage->ImageCodeType = EfiLoaderCode;
-    LoadedImage->ImageDataType = EfiLoaderData;
-  } else {
-    LoadedImage->ImageCodeType = EfiBootServicesCode;
-    LoadedImage->ImageDataType = EfiBootServicesData;
+    return Status;
   }
 
-  //
-  // Install LoadedImage and the image's entry point.
-  //
-  *ImageHandle = NULL;
-  Status       = gBS->InstallMultipleProtocolInterfaces (
-                        ImageHandle,
-                        &gEfiLoadedImageProtocolGuid,
-                        LoadedImage,
-                        &mOcLoadedImageProtocolGuid,
-                        OcLoadedImage,
-                        NULL
-                        );
-  if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_INFO, "OCB: PeCoff proto install error - %r\n", Status));
-    FreePool (OcLoadedImage);
-    FreePages (DestinationBuffer, EFI_SIZE_TO_PAGES (ImageContext.SizeOfImage));
-    return Status;
+  if (RelocationData != NULL) {
+    InternalImageCacheInsert (
+      SourceBuffer,
+      (UINT32)SourceSize,
+      DestinationArea,
+      ImageContext.SizeOfImage,
+      ImageContext.AddressOfEntryPoint,
+      ImageContext.Subsystem,
+      RelocationData
+      );
   }
 
   DEBUG ((DEBUG_VERBOSE, "OCB: Loaded image at %p\n", *ImageHandle));
@@ -419,6 +680,46 @@ OcImageLoaderLoad (
   return EFI_SUCCESS;
 }
 
+EFI_STATUS
+EFIAPI
+OcImageLoaderLoad (
+  IN  BOOLEAN                   BootPolicy,
+  IN  EFI_HANDLE                ParentImageHandle,
+  IN  EFI_DEVICE_PATH_PROTOCOL  *DevicePath,
+  IN  VOID                      *SourceBuffer OPTIONAL,
+  IN  UINTN                     SourceSize,
+  OUT EFI_HANDLE                *ImageHandle
+  )
+{
+  return InternalImageLoaderLoad (
+           ParentImageHandle,
+           SourceBuffer,
+           SourceSize,
+           FALSE,
+           ImageHandle
+           );
+}
+
+EFI_STATUS
+EFIAPI
+OcImageLoaderLoadCached (
+  IN  BOOLEAN                   BootPolicy,
+  IN  EFI_HANDLE                ParentImageHandle,
+  IN  EFI_DEVICE_PATH_PROTOCOL  *DevicePath,
+  IN  VOID                      *SourceBuffer OPTIONAL,
+  IN  UINTN                     SourceSize,
+  OUT EFI_HANDLE                *ImageHandle
+  )
+{
+  return InternalImageLoaderLoad (
+           ParentImageHandle,
+           SourceBuffer,
+           SourceSize,
+           TRUE,
+           ImageHandle
+           );
+}
+
 /**
   Unload image routine for OcImageLoaderLoad.
 
@@ -335,6 +335,10 @@ OcRunBootPicker (
         SaidWelcome = TRUE;
       }
 
+      if ((Context->TimeoutSeconds > 0) && (BootContext->DefaultEntry != NULL)) {
+        InternalStartBootEntryPrefetch (BootContext->DefaultEntry);
+      }
+
       Status = RunShowMenu (BootContext, &Chosen);
 
       if (EFI_ERROR (Status) && (Status != EFI_ABORTED)) {
@@ -348,6 +352,7 @@ OcRunBootPicker (
 
       if (EFI_ERROR (Status) && (Status != EFI_ABORTED)) {
         DEBUG ((DEBUG_ERROR, "OCB: ShowMenu failed - %r\n", Status));
+        InternalCancelBootEntryPrefetch ();
         OcFreeBootContext (BootContext);
         return Status;
       }
@@ -455,6 +460,7 @@ OcRunBootPicker (
       OcKeyMapFlush (KeyMap, 0, TRUE);
     }
 
+    InternalCancelBootEntryPrefetch ();
     OcFreeBootContext (BootContext);
   }
 }
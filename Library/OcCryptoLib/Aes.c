@@ -62,7 +62,7 @@ NOTE:   String length must be evenly divisible by 16byte (str_len % 16 == 0)
 
 **/
 
-#include "CryptoInternal.h"
+#include "AesInternal.h"
 
 //
 // The number of columns comprising a state in AES (Nb). This is a CONSTant in AES. Value=4
@@ -88,6 +88,17 @@ NOTE:   String length must be evenly divisible by 16byte (str_len % 16 == 0)
 //
 typedef UINT8 AES_INTERNAL_STATE[4][4];
 
+//
+// Number of CTR keystream blocks generated at once with AES-NI.
+//
+#define AES_NI_CTR_BLOCKS  16
+
+//
+// AES-NI availability, queried on first use.
+//
+STATIC BOOLEAN  mAesNiChecked;
+STATIC BOOLEAN  mAesNiSupported;
+
 //
 // The lookup-tables are marked CONST so they can be placed in read-only storage instead of RAM
 // The numbers below can be computed dynamically trading ROM for RAM -
@@ -578,6 +589,81 @@ XorWithIv (
   }
 }
 
+STATIC
+BOOLEAN
+IsAesNiAvailable (
+  VOID
+  )
+{
+  if (!mAesNiChecked) {
+    mAesNiSupported = AesNiIsSupported ();
+    mAesNiChecked   = TRUE;
+  }
+
+  return mAesNiSupported;
+}
+
+//
+// Increment the big endian counter in Iv and handle overflow.
+//
+STATIC
+VOID
+IncrementIv (
+  IN OUT UINT8  *Iv
+  )
+{
+  INT32  Bi;
+
+  for (Bi = (AES_BLOCK_SIZE - 1); Bi >= 0; --Bi) {
+    //
+    // Inc will owerflow
+    //
+    if (Iv[Bi] == 255) {
+      Iv[Bi] = 0;
+      continue;
+    }
+
+    Iv[Bi] += 1;
+    break;
+  }
+}
+
+STATIC
+VOID
+AesNiCtrXcryptBuffer (
+  IN OUT AES_CONTEXT  *Context,
+  IN OUT UINT8        *Data,
+  IN     UINT32       Len
+  )
+{
+  UINT8   Buffer[AES_BLOCK_SIZE * AES_NI_CTR_BLOCKS];
+  UINT32  Blocks;
+  UINT32  Size;
+  UINT32  I;
+
+  while (Len > 0) {
+    Blocks = Len / AES_BLOCK_SIZE + (Len % AES_BLOCK_SIZE != 0 ? 1 : 0);
+    Blocks = MIN (Blocks, AES_NI_CTR_BLOCKS);
+
+    for (I = 0; I < Blocks; ++I) {
+      CopyMem (&Buffer[I * AES_BLOCK_SIZE], Context->Iv, AES_BLOCK_SIZE);
+      IncrementIv (Context->Iv);
+    }
+
+    AesNiEncryptBlocks (Context->RoundKey, Nr, Buffer, Blocks);
+
+    Size = MIN (Len, Blocks * AES_BLOCK_SIZE);
+    for (I = 0; I < Size; ++I) {
+      Data[I] ^= Buffer[I];
+    }
+
+    Data += Size;
+    Len  -= Size;
+  }
+
+  SecureZeroMem (Buffer, sizeof (Buffer));
+}
+
 //
 // Public functions
 //
@@ -592,6 +678,11 @@ AesCbcEncryptBuffer (
   UINT32  I;
   UINT8   *Iv;
 
+  if (IsAesNiAvailable ()) {
+    AesNiCbcEncrypt (Context->RoundKey, Nr, Context->Iv, Data, Len / AES_BLOCK_SIZE);
+    return;
+  }
+
   Iv = Context->Iv;
 
   for (I = 0; I < Len; I += AES_BLOCK_SIZE) {
@@ -617,6 +708,11 @@ AesCbcDecryptBuffer (
   UINT32  I;
   UINT8   StoreNextIv[AES_BLOCK_SIZE];
 
+  if (IsAesNiAvailable ()) {
+    AesNiCbcDecrypt (Context->RoundKey, Nr, Context->Iv, Data, Len / AES_BLOCK_SIZE);
+    return;
+  }
+
   for (I = 0; I < Len; I += AES_BLOCK_SIZE) {
     CopyMem (StoreNextIv, Data, AES_BLOCK_SIZE);
     InvCipher ((AES_INTERNAL_STATE *)Data, Context->RoundKey);
@@ -641,6 +737,11 @@ AesCtrXcryptBuffer (
   UINT32  I;
   INT32   Bi;
 
+  if (IsAesNiAvailable ()) {
+    AesNiCtrXcryptBuffer (Context, Data, Len);
+    return;
+  }
+
   for (I = 0, Bi = AES_BLOCK_SIZE; I < Len; ++I, ++Bi) {
     //
     // We need to regen xor compliment in buffer
@@ -648,26 +749,12 @@ AesCtrXcryptBuffer (
     if (Bi == AES_BLOCK_SIZE) {
       CopyMem (Buffer, Context->Iv, AES_BLOCK_SIZE);
       Cipher ((AES_INTERNAL_STATE *)Buffer, Context->RoundKey);
-
-      //
-      // Increment Iv and handle overflow
-      //
-      for (Bi = (AES_BLOCK_SIZE - 1); Bi >= 0; --Bi) {
-        //
-        // Inc will owerflow
-        //
-        if (Context->Iv[Bi] == 255) {
-          Context->Iv[Bi] = 0;
-          continue;
-        }
-
-        Context->Iv[Bi] += 1;
-        break;
-      }
-
+      IncrementIv (Context->Iv);
       Bi = 0;
     }
 
     Data[I] = (Data[I] ^ Buffer[Bi]);
   }
+
+  SecureZeroMem (Buffer, sizeof (Buffer));
 }
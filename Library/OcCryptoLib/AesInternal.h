@@ -0,0 +1,90 @@
+/** @file
+
+OcCryptoLib
+
+Copyright (c) 2023, Acidanthera
+
+All rights reserved.
+
+This program and the accompanying materials
+are licensed and made available under the terms and conditions of the BSD License
+which accompanies this distribution.  The full text of the license may be found at
+http://opensource.org/licenses/bsd-license.php
+
+THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#ifndef OC_AES_INTERNAL_H
+#define OC_AES_INTERNAL_H
+
+#include "CryptoInternal.h"
+
+/**
+  Check whether the CPU implements the AES-NI instruction set.
+
+  @retval TRUE when AesNi functions may be called.
+**/
+BOOLEAN
+EFIAPI
+AesNiIsSupported (
+  VOID
+  );
+
+/**
+  Encrypt blocks in place without chaining (ECB).
+
+  @param[in]     RoundKey  Expanded key of Rounds + 1 round keys.
+  @param[in]     Rounds    Number of AES rounds (Nr).
+  @param[in,out] Data      Blocks to encrypt.
+  @param[in]     Blocks    Number of AES_BLOCK_SIZE blocks in Data.
+**/
+VOID
+EFIAPI
+AesNiEncryptBlocks (
+  IN     CONST UINT8  *RoundKey,
+  IN     UINTN        Rounds,
+  IN OUT UINT8        *Data,
+  IN     UINTN        Blocks
+  );
+
+/**
+  Encrypt blocks in place in CBC mode.
+
+  @param[in]     RoundKey  Expanded key of Rounds + 1 round keys.
+  @param[in]     Rounds    Number of AES rounds (Nr).
+  @param[in,out] Iv        Initialisation vector, updated for the next call.
+  @param[in,out] Data      Blocks to encrypt.
+  @param[in]     Blocks    Number of AES_BLOCK_SIZE blocks in Data.
+**/
+VOID
+EFIAPI
+AesNiCbcEncrypt (
+  IN     CONST UINT8  *RoundKey,
+  IN     UINTN        Rounds,
+  IN OUT UINT8        *Iv,
+  IN OUT UINT8        *Data,
+  IN     UINTN        Blocks
+  );
+
+/**
+  Decrypt blocks in place in CBC mode.
+
+  @param[in]     RoundKey  Expanded key of Rounds + 1 round keys.
+  @param[in]     Rounds    Number of AES rounds (Nr).
+  @param[in,out] Iv        Initialisation vector, updated for the next call.
+  @param[in,out] Data      Blocks to decrypt.
+  @param[in]     Blocks    Number of AES_BLOCK_SIZE blocks in Data.
+**/
+VOID
+EFIAPI
+AesNiCbcDecrypt (
+  IN     CONST UINT8  *RoundKey,
+  IN     UINTN        Rounds,
+  IN OUT UINT8        *Iv,
+  IN OUT UINT8        *Data,
+  IN     UINTN        Blocks
+  );
+
+#endif // OC_AES_INTERNAL_H
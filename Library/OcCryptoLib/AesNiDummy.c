@@ -0,0 +1,74 @@
+/** @file
+  Copyright (C) 2023, Acidanthera. All rights reserved.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+**/
+
+#include "AesInternal.h"
+
+BOOLEAN
+EFIAPI
+AesNiIsSupported (
+  VOID
+  )
+{
+  return FALSE;
+}
+
+VOID
+EFIAPI
+AesNiEncryptBlocks (
+  IN     CONST UINT8  *RoundKey,
+  IN     UINTN        Rounds,
+  IN OUT UINT8        *Data,
+  IN     UINTN        Blocks
+  )
+{
+  (VOID)RoundKey;
+  (VOID)Rounds;
+  (VOID)Data;
+  (VOID)Blocks;
+  ASSERT (FALSE);
+}
+
+VOID
+EFIAPI
+AesNiCbcEncrypt (
+  IN     CONST UINT8  *RoundKey,
+  IN     UINTN        Rounds,
+  IN OUT UINT8        *Iv,
+  IN OUT UINT8        *Data,
+  IN     UINTN        Blocks
+  )
+{
+  (VOID)RoundKey;
+  (VOID)Rounds;
+  (VOID)Iv;
+  (VOID)Data;
+  (VOID)Blocks;
+  ASSERT (FALSE);
+}
+
+VOID
+EFIAPI
+AesNiCbcDecrypt (
+  IN     CONST UINT8  *RoundKey,
+  IN     UINTN        Rounds,
+  IN OUT UINT8        *Iv,
+  IN OUT UINT8        *Data,
+  IN     UINTN        Blocks
+  )
+{
+  (VOID)RoundKey;
+  (VOID)Rounds;
+  (VOID)Iv;
+  (VOID)Data;
+  (VOID)Blocks;
+  ASSERT (FALSE);
+}
@@ -161,17 +161,32 @@ BigNumCalculateMontParams (
   IN     OC_BN_WORD        *Scratch
   );
 
+/**
+  NumWords for the base in the Montgomery Domain, and then 2 * NumWords + 1
+  for the full square before Montgomery Reduction.
+
+  @param[in] NumWords  The number of Words of Result, A and N. Must be at most
+                       OC_BN_MONT_MAX_LEN.
+**/
+#define BIG_NUM_POW_MOD_SCRATCH_SIZE(NumWords) \
+  (OC_BN_SIZE (NumWords) * 3U + OC_BN_WORD_SIZE)
+
+STATIC_ASSERT (
+  OC_BN_MONT_MAX_SIZE <= (MAX_UINTN - OC_BN_WORD_SIZE) / 3U,
+  "The definition of BIG_NUM_POW_MOD_SCRATCH_SIZE may cause an overflow"
+  );
+
 /**
   Caulculates the exponentiation of A with B mod N.
 
   @param[in,out] Result    The buffer to return the result into.
   @param[in]     NumWords  The number of Words of Result, A, N and RSqrMod.
   @param[in]     A         The base.
-  @param[in]     B         The exponent.
+  @param[in]     B         The exponent. Must be odd and at least 3.
   @param[in]     N         The modulus.
   @param[in]     N0Inv     The Montgomery Inverse of N.
   @param[in]     RSqrMod   Montgomery's R^2 mod N.
-  @param[in]     ATmp      Scratch buffer of NumWords.
+  @param[in]     Scratch   Scratch buffer BIG_NUM_POW_MOD_SCRATCH_SIZE(NumWords).
 
   @returns  Whether the operation was completes successfully.
 
@@ -185,7 +200,7 @@ BigNumPowMod (
   IN     CONST OC_BN_WORD  *N,
   IN     OC_BN_WORD        N0Inv,
   IN     CONST OC_BN_WORD  *RSqrMod,
-  IN     OC_BN_WORD        *ATmp
+  IN     OC_BN_WORD        *Scratch
   );
 
 #endif // BIG_NUM_LIB_H
@@ -433,117 +433,136 @@ BigNumMontMul (
 }
 
 /**
-  This is an optimized version of the call
-  BigNumMontMulRow (C, 0, A, N, N0Inv)
+  Calculates the Montgomery square of A mod N.
 
-  Calculates a row of the product of 0 and A mod N.
+  Unlike BigNumMontMul, every cross product A[i] * A[j] with i != j is only
+  computed once and doubled, which saves half of the multiplications of the
+  standard product. The full square is then reduced Word by Word.
 
-  @param[in,out] Result  The result buffer.
-  @param[in]     NumWords  The number of Words of Result and N.
-  @param[in]     N       The modulus.
-  @param[in]     N0Inv   The Montgomery Inverse of N.
+  @param[out] Result    The result buffer. May be A.
+  @param[in]  NumWords  The number of Words of Result, A and N.
+  @param[in]  A         The number to square.
+  @param[in]  N         The modulus.
+  @param[in]  N0Inv     The Montgomery Inverse of N.
+  @param[in]  Product   Scratch buffer of 2 * NumWords + 1 Words.
 
 **/
 STATIC
 VOID
-BigNumMontMulRow0 (
-  IN OUT OC_BN_WORD        *Result,
-  IN     OC_BN_NUM_WORDS   NumWords,
-  IN     CONST OC_BN_WORD  *N,
-  IN     OC_BN_WORD        N0Inv
+BigNumMontSqr (
+  OUT OC_BN_WORD        *Result,
+  IN  OC_BN_NUM_WORDS   NumWords,
+  IN  CONST OC_BN_WORD  *A,
+  IN  CONST OC_BN_WORD  *N,
+  IN  OC_BN_WORD        N0Inv,
+  IN  OC_BN_WORD        *Product
   )
 {
+  UINTN  RowIndex;
   UINTN  CompIndex;
 
-  OC_BN_WORD  CCurMontHi;
-  OC_BN_WORD  CCurMontLo;
+  OC_BN_WORD  Carry;
+  OC_BN_WORD  Word;
   OC_BN_WORD  TFirst;
 
   ASSERT (Result != NULL);
   ASSERT (NumWords > 0);
+  ASSERT (A != NULL);
   ASSERT (N != NULL);
   ASSERT (N0Inv != 0);
+  ASSERT (Product != NULL);
+
+  ZeroMem (Product, OC_BN_SIZE (2 * NumWords + 1));
+  //
+  // Standard multiplication of the cross products
+  // C = sum (A[i] * A[j] * 2^(#Bits(word) * (i + j))) for i < j
+  //
+  for (RowIndex = 0; RowIndex < NumWords - 1U; ++RowIndex) {
+    Carry = 0;
+    for (CompIndex = RowIndex + 1; CompIndex < NumWords; ++CompIndex) {
+      Product[RowIndex + CompIndex] = BigNumWordAddMulCarry (
+                                        &Carry,
+                                        Product[RowIndex + CompIndex],
+                                        A[RowIndex],
+                                        A[CompIndex],
+                                        Carry
+                                        );
+    }
+
+    Product[RowIndex + NumWords] = Carry;
+  }
+
   //
-  // Montgomery Reduction preparation
-  // As N_first is reduced mod 2^#Bits (word), we reduce C as well.
-  // Due to the reduction, the high bits are discarded safely.
-  // t_first = C * N_first
+  // Every cross product occurs twice in the square.
+  // C = 2 * C
   //
-  TFirst = Result[0] * N0Inv;
+  Carry = 0;
+  for (CompIndex = 0; CompIndex < 2U * NumWords; ++CompIndex) {
+    Word               = Product[CompIndex];
+    Product[CompIndex] = (Word << 1U) | Carry;
+    Carry              = Word >> (OC_BN_WORD_NUM_BITS - 1U);
+  }
+
   //
-  // Montgomery Reduction
-  // 1. C = C + t_first * N
-  // 2. In the first step, only the carries are actually used, so the
-  //    division by R can be omited.
+  // Add the squares of the individual Words.
+  // C = C + sum (A[i]^2 * 2^(#Bits(word) * 2 * i))
   //
-  CCurMontLo = BigNumWordAddMul (&CCurMontHi, Result[0], TFirst, N[0]);
-  for (CompIndex = 1; CompIndex < NumWords; ++CompIndex) {
-    //
-    // Montgomery Reduction
-    // 1. C = C + t_first * N + carry
-    //
-    CCurMontLo = BigNumWordAddMulCarry (
-                   &CCurMontHi,
-                   Result[CompIndex],
-                   TFirst,
-                   N[CompIndex],
-                   CCurMontHi
-                   );
-    //
-    // 2. The index shift translates to a bitshift equivalent to the division
-    //    by R = 2^#Bits (word).
-    //    C = C / R
-    //
-    Result[CompIndex - 1] = CCurMontLo;
+  Carry = 0;
+  for (RowIndex = 0; RowIndex < NumWords; ++RowIndex) {
+    Product[2 * RowIndex] = BigNumWordAddMulCarry (
+                              &Word,
+                              Product[2 * RowIndex],
+                              A[RowIndex],
+                              A[RowIndex],
+                              Carry
+                              );
+    Product[2 * RowIndex + 1] += Word;
+    Carry                      = Product[2 * RowIndex + 1] < Word ? 1U : 0U;
   }
 
   //
-  // Assign the most significant byte the remaining carry.
+  // The square of a NumWords number always fits into 2 * NumWords Words.
   //
-  Result[CompIndex - 1] = CCurMontHi;
-}
-
-/**
-  This is an optimized version of the call
-  BigNumMontMul (C, 1, A, N, N0Inv)
-
-  @param[in,out] Result    The result buffer.
-  @param[in]     NumWords  The number of Words of Result, A and N.
-  @param[in]     A         The multiplicant.
-  @param[in]     N         The modulus.
-  @param[in]     N0Inv     The Montgomery Inverse of N.
-
-**/
-STATIC
-VOID
-BigNumMontMul1 (
-  IN OUT OC_BN_WORD        *Result,
-  IN     OC_BN_NUM_WORDS   NumWords,
-  IN     CONST OC_BN_WORD  *A,
-  IN     CONST OC_BN_WORD  *N,
-  IN     OC_BN_WORD        N0Inv
-  )
-{
-  UINTN  RowIndex;
-
-  ASSERT (Result != NULL);
-  ASSERT (NumWords > 0);
-  ASSERT (A != NULL);
-  ASSERT (N != NULL);
-  ASSERT (N0Inv != 0);
-
-  ZeroMem (Result, OC_BN_SIZE (NumWords));
+  ASSERT (Carry == 0);
   //
-  // Perform the entire standard multiplication and one Montgomery Reduction.
+  // Montgomery Reduction
+  // 1. C = C + t_first * N * 2^(#Bits(word) * i)
+  // 2. After NumWords steps, the lower half of C is 0 and the upper half
+  //    holds the result, which implies the division by R.
   //
-  BigNumMontMulRow (Result, NumWords, 1, A, N, N0Inv);
+  for (RowIndex = 0; RowIndex < NumWords; ++RowIndex) {
+    TFirst = Product[RowIndex] * N0Inv;
+
+    Carry = 0;
+    for (CompIndex = 0; CompIndex < NumWords; ++CompIndex) {
+      Product[RowIndex + CompIndex] = BigNumWordAddMulCarry (
+                                        &Carry,
+                                        Product[RowIndex + CompIndex],
+                                        TFirst,
+                                        N[CompIndex],
+                                        Carry
+                                        );
+    }
+
+    //
+    // As C < R^2 + R * N, the carry cannot propagate beyond the extra Word.
+    //
+    for (CompIndex = RowIndex + NumWords; Carry != 0; ++CompIndex) {
+      ASSERT (CompIndex <= 2U * NumWords);
+      Product[CompIndex] += Carry;
+      Carry               = Product[CompIndex] < Carry ? 1U : 0U;
+    }
+  }
+
   //
-  // Perform the remaining Montgomery Reductions.
+  // If the result has wrapped around, C >= N is true and we reduce mod N.
+  // As with BigNumMontMulRow, the borrow is the discarded extra Word.
   //
-  for (RowIndex = 1; RowIndex < NumWords; ++RowIndex) {
-    BigNumMontMulRow0 (Result, NumWords, N, N0Inv);
+  if (Product[2 * NumWords] != 0) {
+    BigNumSub (&Product[NumWords], NumWords, &Product[NumWords], N);
   }
 
+  CopyMem (Result, &Product[NumWords], OC_BN_SIZE (NumWords));
   //
   // As this implementation only reduces mod N on overflow and not for every
   // yes-instance of C >= N, any sequence of Montgomery Multiplications must be
@@ -560,10 +579,12 @@ BigNumPowMod (
   IN     CONST OC_BN_WORD  *N,
   IN     OC_BN_WORD        N0Inv,
   IN     CONST OC_BN_WORD  *RSqrMod,
-  IN     OC_BN_WORD        *ATmp
+  IN     OC_BN_WORD        *Scratch
   )
 {
-  UINTN  Index;
+  OC_BN_WORD  *ATmp;
+  OC_BN_WORD  *Product;
+  UINT32      ExpBit;
 
   ASSERT (Result != NULL);
   ASSERT (NumWords > 0);
@@ -571,59 +592,59 @@ BigNumPowMod (
   ASSERT (N != NULL);
   ASSERT (N0Inv != 0);
   ASSERT (RSqrMod != NULL);
+  ASSERT (Scratch != NULL);
   //
-  // Currently, only the most frequent exponents are supported.
+  // The last step takes the result out of the Montgomery Domain by multiplying
+  // with A, which requires the least significant bit of B to be set. This is
+  // true for any valid RSA exponent.
   //
-  if ((B != 0x10001) && (B != 3)) {
+  if (((B & 1U) == 0) || (B < 3)) {
     DEBUG ((DEBUG_INFO, "OCCR: Unsupported exponent: %x\n", B));
     return FALSE;
   }
 
+  ATmp    = Scratch;
+  Product = &Scratch[NumWords];
+
   //
   // Convert A into the Montgomery Domain.
   // ATmp = MM (A, R^2 mod N)
   //
   BigNumMontMul (ATmp, NumWords, A, RSqrMod, N, N0Inv);
+  CopyMem (Result, ATmp, OC_BN_SIZE (NumWords));
 
-  if (B == 0x10001) {
+  //
+  // Left-to-right binary exponentiation for all bits but the most and the
+  // least significant one. The most significant bit is covered by the
+  // initialisation above.
+  //
+  for (ExpBit = GetPowerOfTwo32 (B) >> 1U; ExpBit > 1; ExpBit >>= 1U) {
     //
-    // Squaring the intermediate results 16 times yields A'^ (2^16).
+    // Result = MM (Result, Result)
     //
-    for (Index = 0; Index < 16; Index += 2) {
-      //
-      // Result = MM (ATmp, ATmp)
-      //
-      BigNumMontMul (Result, NumWords, ATmp, ATmp, N, N0Inv);
+    BigNumMontSqr (Result, NumWords, Result, N, N0Inv, Product);
+
+    if ((B & ExpBit) != 0) {
       //
-      // ATmp = MM (Result, Result)
+      // Result = MM (Result, ATmp)
       //
-      BigNumMontMul (ATmp, NumWords, Result, Result, N, N0Inv);
+      BigNumMontMul (Product, NumWords, Result, ATmp, N, N0Inv);
+      CopyMem (Result, Product, OC_BN_SIZE (NumWords));
     }
-
-    //
-    // Because A is not within the Montgomery Domain, this implies another
-    // division by R, which takes the result out of the Montgomery Domain.
-    // C = MM (ATmp, A)
-    //
-    BigNumMontMul (Result, NumWords, ATmp, A, N, N0Inv);
-  } else {
-    //
-    // Result = MM (ATmp, ATmp)
-    //
-    BigNumMontMul (Result, NumWords, ATmp, ATmp, N, N0Inv);
-    //
-    // ATmp = MM (Result, ATmp)
-    //
-    BigNumMontMul (ATmp, NumWords, Result, ATmp, N, N0Inv);
-    //
-    // Perform a Montgomery Multiplication with 1, which effectively is a
-    // division by R, taking the result out of the Montgomery Domain.
-    // C = MM (ATmp, 1)
-    // TODO: Is this needed or can we just multiply with A above?
-    //
-    BigNumMontMul1 (Result, NumWords, ATmp, N, N0Inv);
   }
 
+  //
+  // Result = MM (Result, Result)
+  //
+  BigNumMontSqr (Result, NumWords, Result, N, N0Inv, Product);
+  //
+  // Because A is not within the Montgomery Domain, this implies another
+  // division by R, which takes the result out of the Montgomery Domain.
+  // C = MM (Result, A)
+  //
+  BigNumMontMul (Product, NumWords, Result, A, N, N0Inv);
+  CopyMem (Result, Product, OC_BN_SIZE (NumWords));
+
   //
   // The Montgomery Multiplications above only ensure the result is mod N when
   // it does not fit within #Bits(N). For N != 0, which is an obvious
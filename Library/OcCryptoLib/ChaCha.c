@@ -22,9 +22,7 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
  Public domain.
  */
 
-#include <Library/BaseLib.h>
-#include <Library/BaseMemoryLib.h>
-#include <Library/OcCryptoLib.h>
+#include "ChaChaInternal.h"
 
 #define U32V(v)           ((UINT32)(v) & 0xFFFFFFFFU)
 #define ROTATE(v, c)      (LRotU32 ((v), (c)))
@@ -44,6 +42,61 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
   c = PLUS(c, d);                \
   b = ROTATE(XOR(b, c), 7);
 
+//
+// SSE2 availability, queried on first use.
+//
+STATIC BOOLEAN  mChaChaSse2Checked;
+STATIC BOOLEAN  mChaChaSse2Supported;
+
+STATIC
+BOOLEAN
+IsChaChaSse2Available (
+  VOID
+  )
+{
+  if (!mChaChaSse2Checked) {
+    mChaChaSse2Supported = ChaChaSse2IsSupported ();
+    mChaChaSse2Checked   = TRUE;
+  }
+
+  return mChaChaSse2Supported;
+}
+
+/**
+  Compute keystream for the next CHACHA_SSE2_BLOCKS blocks and advance
+  the block counter accordingly.
+
+  @param[in,out] Context    ChaCha context.
+  @param[out]    Keystream  CHACHA_SSE2_BLOCKS * CHACHA_BLOCK_SIZE bytes.
+**/
+STATIC
+VOID
+ChaChaSse2Keystream (
+  IN OUT CHACHA_CONTEXT  *Context,
+  OUT    UINT8           *Keystream
+  )
+{
+  UINT32  State[16][CHACHA_SSE2_BLOCKS];
+  UINT32  Word;
+  UINT32  Block;
+
+  for (Block = 0; Block < CHACHA_SSE2_BLOCKS; ++Block) {
+    for (Word = 0; Word < ARRAY_SIZE (State); ++Word) {
+      State[Word][Block] = Context->Input[Word];
+    }
+
+    Context->Input[12] = PLUSONE (Context->Input[12]);
+
+    if (Context->Input[12] == 0) {
+      Context->Input[13] = PLUSONE (Context->Input[13]);
+    }
+  }
+
+  ChaChaSse2Blocks4 (&State[0][0], Keystream);
+
+  SecureZeroMem (State, sizeof (State));
+}
+
 VOID
 ChaChaInitCtx (
   OUT CHACHA_CONTEXT  *Context,
@@ -113,9 +166,26 @@ ChaChaCryptBuffer (
   UINT8   *Ctarget;
   UINT8   Tmp[64];
   UINT32  Index;
+  UINT8   Stream[CHACHA_SSE2_BLOCKS * CHACHA_BLOCK_SIZE];
 
   Ctarget = NULL;
 
+  if ((Length >= sizeof (Stream)) && IsChaChaSse2Available ()) {
+    while (Length >= sizeof (Stream)) {
+      ChaChaSse2Keystream (Context, Stream);
+
+      for (Index = 0; Index < sizeof (Stream); ++Index) {
+        Destination[Index] = Source[Index] ^ Stream[Index];
+      }
+
+      Length      -= sizeof (Stream);
+      Destination += sizeof (Stream);
+      Source      += sizeof (Stream);
+    }
+
+    SecureZeroMem (Stream, sizeof (Stream));
+  }
+
   if (Length == 0) {
     return;
   }
@@ -247,3 +317,29 @@ ChaChaCryptBuffer (
     Source      += sizeof (Tmp);
   }
 }
+
+VOID
+ChaChaGenerateKeystream (
+  IN OUT CHACHA_CONTEXT  *Context,
+  OUT    UINT8           *Destination,
+  IN     UINT32          Length
+  )
+{
+  if ((Length >= CHACHA_SSE2_BLOCKS * CHACHA_BLOCK_SIZE) && IsChaChaSse2Available ()) {
+    while (Length >= CHACHA_SSE2_BLOCKS * CHACHA_BLOCK_SIZE) {
+      ChaChaSse2Keystream (Context, Destination);
+      Length      -= CHACHA_SSE2_BLOCKS * CHACHA_BLOCK_SIZE;
+      Destination += CHACHA_SSE2_BLOCKS * CHACHA_BLOCK_SIZE;
+    }
+  }
+
+  if (Length == 0) {
+    return;
+  }
+
+  //
+  // Encrypting zeroes yields the keystream.
+  //
+  ZeroMem (Destination, Length);
+  ChaChaCryptBuffer (Context, Destination, Destination, Length);
+}
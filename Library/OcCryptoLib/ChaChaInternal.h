@@ -0,0 +1,59 @@
+/** @file
+
+OcCryptoLib
+
+Copyright (c) 2023, Acidanthera
+
+All rights reserved.
+
+This program and the accompanying materials
+are licensed and made available under the terms and conditions of the BSD License
+which accompanies this distribution.  The full text of the license may be found at
+http://opensource.org/licenses/bsd-license.php
+
+THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#ifndef OC_CHACHA_INTERNAL_H
+#define OC_CHACHA_INTERNAL_H
+
+#include "CryptoInternal.h"
+
+//
+// ChaCha block size.
+//
+#define CHACHA_BLOCK_SIZE  64
+
+//
+// Number of ChaCha blocks computed at once with SSE2.
+//
+#define CHACHA_SSE2_BLOCKS  4
+
+/**
+  Check whether the CPU implements the SSE2 instruction set.
+
+  @retval TRUE when ChaChaSse2 functions may be called.
+**/
+BOOLEAN
+EFIAPI
+ChaChaSse2IsSupported (
+  VOID
+  );
+
+/**
+  Compute keystream for CHACHA_SSE2_BLOCKS blocks at once.
+
+  @param[in]  State      Block states, word i of block j is at
+                         State[i * CHACHA_SSE2_BLOCKS + j].
+  @param[out] Keystream  CHACHA_SSE2_BLOCKS * CHACHA_BLOCK_SIZE bytes of keystream.
+**/
+VOID
+EFIAPI
+ChaChaSse2Blocks4 (
+  IN  CONST UINT32  *State,
+  OUT UINT8         *Keystream
+  );
+
+#endif // OC_CHACHA_INTERNAL_H
@@ -0,0 +1,34 @@
+/** @file
+  Copyright (C) 2023, Acidanthera. All rights reserved.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+**/
+
+#include "ChaChaInternal.h"
+
+BOOLEAN
+EFIAPI
+ChaChaSse2IsSupported (
+  VOID
+  )
+{
+  return FALSE;
+}
+
+VOID
+EFIAPI
+ChaChaSse2Blocks4 (
+  IN  CONST UINT32  *State,
+  OUT UINT8         *Keystream
+  )
+{
+  (VOID)State;
+  (VOID)Keystream;
+  ASSERT (FALSE);
+}
@@ -154,7 +154,7 @@ SigVerifyShaHashBySize (
   @param[in] Hash           The Hash digest of the signed data.
   @param[in] HashSize       Size, in bytes, of Hash.
   @param[in] Algorithm      The RSA algorithm used.
-  @param[in] Scratch        Scratch buffer 3xModulo.
+  @param[in] Scratch        Scratch buffer RSA_SCRATCH_BUFFER_SIZE(Modulo).
 
   @returns  Whether the signature has been successfully verified as valid.
 
@@ -391,7 +391,7 @@ RsaVerifySigHashFromProcessed (
   @param[in] Data           The signed data to verify.
   @param[in] DataSize       Size, in bytes, of Data.
   @param[in] Algorithm      The RSA algorithm used.
-  @param[in] Scratch        Scratch buffer 3xModulo.
+  @param[in] Scratch        Scratch buffer RSA_SCRATCH_BUFFER_SIZE(Modulo).
 
   @returns  Whether the signature has been successfully verified as valid.
 
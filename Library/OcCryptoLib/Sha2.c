@@ -87,7 +87,7 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 GLOBAL_REMOVE_IF_UNREFERENCED BOOLEAN  mIsAccelEnabled;
 
 #ifdef OC_CRYPTO_SUPPORTS_SHA256
-STATIC CONST UINT32  SHA256_K[64] = {
+CONST UINT32  SHA256_K[64] = {
   0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
   0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
   0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
@@ -244,9 +244,19 @@ Sha256Update (
   UINTN           Len
   )
 {
-  UINT32  Index;
+  UINTN  Index;
 
   for (Index = 0; Index < Len; ++Index) {
+    //
+    // Transform whole blocks directly from the input when nothing is buffered.
+    //
+    if ((Context->DataLen == 0) && (Len - Index >= SHA256_BLOCK_SIZE)) {
+      Sha256Transform (Context, &Data[Index]);
+      Context->BitLen += 512;
+      Index           += SHA256_BLOCK_SIZE - 1;
+      continue;
+    }
+
     Context->Data[Context->DataLen] = Data[Index];
     Context->DataLen++;
     if (Context->DataLen == 64) {
@@ -325,6 +335,111 @@ Sha256 (
   ZeroMem (&Ctx, sizeof (Ctx));
 }
 
+STATIC BOOLEAN  mSha256Ssse3Checked;
+STATIC BOOLEAN  mSha256Ssse3Supported;
+
+STATIC
+BOOLEAN
+IsSha256Ssse3Available (
+  VOID
+  )
+{
+  if (!mSha256Ssse3Checked) {
+    mSha256Ssse3Supported = Sha256Ssse3IsSupported ();
+    mSha256Ssse3Checked   = TRUE;
+  }
+
+  return mSha256Ssse3Supported;
+}
+
+/**
+  Hash up to SHA256_MULTI_LANES messages in parallel. Whole blocks common
+  to all messages are processed at once, the rest of every message
+  is finished with the scalar code.
+
+  @param[in,out] Messages  Messages to hash.
+  @param[in]     Count     Number of messages, 1 to SHA256_MULTI_LANES.
+**/
+STATIC
+VOID
+Sha256MultiLanes (
+  IN OUT SHA256_MULTI_MESSAGE  *Messages,
+  IN     UINTN                 Count
+  )
+{
+  SHA256_CONTEXT  Ctx;
+  UINT32          State[8][SHA256_MULTI_LANES];
+  CONST UINT8     *Data[SHA256_MULTI_LANES];
+  UINTN           Blocks;
+  UINTN           Lane;
+  UINTN           Index;
+
+  ASSERT (Count > 0 && Count <= SHA256_MULTI_LANES);
+
+  Blocks = MAX_UINTN;
+  for (Lane = 0; Lane < SHA256_MULTI_LANES; ++Lane) {
+    //
+    // Unused lanes repeat the first message, their results are discarded.
+    //
+    Data[Lane] = Messages[Lane < Count ? Lane : 0].Data;
+    Blocks     = MIN (Blocks, Messages[Lane < Count ? Lane : 0].Length / SHA256_BLOCK_SIZE);
+
+    for (Index = 0; Index < 8; ++Index) {
+      State[Index][Lane] = SHA256_H0[Index];
+    }
+  }
+
+  if (Blocks > 0) {
+    Sha256Ssse3Blocks4 (&State[0][0], Data, Blocks);
+  }
+
+  for (Lane = 0; Lane < Count; ++Lane) {
+    for (Index = 0; Index < 8; ++Index) {
+      Ctx.State[Index] = State[Index][Lane];
+    }
+
+    Ctx.DataLen = 0;
+    Ctx.BitLen  = LShiftU64 (Blocks, 9);
+
+    Sha256Update (
+      &Ctx,
+      Messages[Lane].Data + Blocks * SHA256_BLOCK_SIZE,
+      Messages[Lane].Length - Blocks * SHA256_BLOCK_SIZE
+      );
+    Sha256Final (&Ctx, Messages[Lane].Hash);
+  }
+
+  ZeroMem (&Ctx, sizeof (Ctx));
+  ZeroMem (State, sizeof (State));
+}
+
+VOID
+Sha256Multi (
+  IN OUT SHA256_MULTI_MESSAGE  *Messages,
+  IN     UINTN                 Count
+  )
+{
+  UINTN  Index;
+  UINTN  Lanes;
+
+  if ((Count < 2) || !IsSha256Ssse3Available ()) {
+    for (Index = 0; Index < Count; ++Index) {
+      Sha256 (Messages[Index].Hash, Messages[Index].Data, Messages[Index].Length);
+    }
+
+    return;
+  }
+
+  for (Index = 0; Index < Count; Index += Lanes) {
+    Lanes = MIN (Count - Index, SHA256_MULTI_LANES);
+    if (Lanes == 1) {
+      Sha256 (Messages[Index].Hash, Messages[Index].Data, Messages[Index].Length);
+    } else {
+      Sha256MultiLanes (&Messages[Index], Lanes);
+    }
+  }
+}
+
 #endif
 
 #if defined (OC_CRYPTO_SUPPORTS_SHA384) || defined (OC_CRYPTO_SUPPORTS_SHA512)
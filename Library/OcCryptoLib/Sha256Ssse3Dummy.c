@@ -0,0 +1,36 @@
+/** @file
+  Copyright (C) 2023, Acidanthera. All rights reserved.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+**/
+
+#include "Sha2Internal.h"
+
+BOOLEAN
+EFIAPI
+Sha256Ssse3IsSupported (
+  VOID
+  )
+{
+  return FALSE;
+}
+
+VOID
+EFIAPI
+Sha256Ssse3Blocks4 (
+  IN OUT UINT32       *State,
+  IN     CONST UINT8  *CONST *Data,
+  IN     UINTN        Blocks
+  )
+{
+  (VOID)State;
+  (VOID)Data;
+  (VOID)Blocks;
+  ASSERT (FALSE);
+}
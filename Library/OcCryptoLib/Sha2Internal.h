@@ -31,4 +31,31 @@ Sha512TransformAccel (
   IN     UINTN        BlockNb
   );
 
+/**
+  Check whether the CPU implements the SSSE3 instruction set.
+
+  @retval TRUE when Sha256Ssse3 functions may be called.
+**/
+BOOLEAN
+EFIAPI
+Sha256Ssse3IsSupported (
+  VOID
+  );
+
+/**
+  Update SHA256_MULTI_LANES SHA-256 states with the same number of blocks each.
+
+  @param[in,out] State   Hash states, word i of lane j is at
+                         State[i * SHA256_MULTI_LANES + j].
+  @param[in]     Data    SHA256_MULTI_LANES pointers to the message blocks.
+  @param[in]     Blocks  Number of SHA256_BLOCK_SIZE blocks to process per lane.
+**/
+VOID
+EFIAPI
+Sha256Ssse3Blocks4 (
+  IN OUT UINT32       *State,
+  IN     CONST UINT8  *CONST *Data,
+  IN     UINTN        Blocks
+  );
+
 #endif // OC_SHA2_INTERNAL_H
@@ -0,0 +1,173 @@
+/** @file
+  Scan-scoped cache of file existence probes.
+
+  Boot entry scanning probes the same predefined paths on every file system,
+  often several times, e.g. once per APFS volume sharing a Preboot volume.
+  Each probe opens and closes a file through possibly slow firmware drivers.
+  While a scan is in progress, results are remembered per device handle.
+
+  Copyright (c) 2023, Acidanthera. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-3-Clause
+**/
+
+#include <Uefi.h>
+
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/OcFileLib.h>
+
+typedef struct {
+  LIST_ENTRY    Link;
+  EFI_HANDLE    Device;
+  EFI_STATUS    Status;
+  CHAR16        *Prefix;
+  CHAR16        *FileName;
+} OC_FILE_EXISTS_CACHE_ENTRY;
+
+#define OC_FILE_EXISTS_CACHE_ENTRY_FROM_LINK(This) \
+  BASE_CR ((This), OC_FILE_EXISTS_CACHE_ENTRY, Link)
+
+STATIC LIST_ENTRY  mFileExistsCache = INITIALIZE_LIST_HEAD_VARIABLE (mFileExistsCache);
+STATIC UINTN       mFileExistsCacheDepth;
+
+STATIC
+BOOLEAN
+InternalFileExistsCacheMatch (
+  IN CONST OC_FILE_EXISTS_CACHE_ENTRY  *Entry,
+  IN       EFI_HANDLE                  Device,
+  IN CONST CHAR16                      *Prefix OPTIONAL,
+  IN CONST CHAR16                      *FileName
+  )
+{
+  if (Entry->Device != Device) {
+    return FALSE;
+  }
+
+  if ((Entry->Prefix == NULL) != (Prefix == NULL)) {
+    return FALSE;
+  }
+
+  if ((Prefix != NULL) && (StrCmp (Entry->Prefix, Prefix) != 0)) {
+    return FALSE;
+  }
+
+  return StrCmp (Entry->FileName, FileName) == 0;
+}
+
+STATIC
+VOID
+InternalFileExistsCacheInsert (
+  IN       EFI_HANDLE  Device,
+  IN CONST CHAR16      *Prefix OPTIONAL,
+  IN CONST CHAR16      *FileName,
+  IN       EFI_STATUS  Status
+  )
+{
+  OC_FILE_EXISTS_CACHE_ENTRY  *Entry;
+  UINTN                       PrefixSize;
+  UINTN                       FileNameSize;
+
+  PrefixSize   = Prefix != NULL ? StrSize (Prefix) : 0;
+  FileNameSize = StrSize (FileName);
+
+  //
+  // Strings are stored right after the entry.
+  //
+  Entry = AllocatePool (sizeof (*Entry) + PrefixSize + FileNameSize);
+  if (Entry == NULL) {
+    return;
+  }
+
+  Entry->Device   = Device;
+  Entry->Status   = Status;
+  Entry->FileName = (CHAR16 *)(Entry + 1);
+  CopyMem (Entry->FileName, FileName, FileNameSize);
+
+  if (Prefix != NULL) {
+    Entry->Prefix = (CHAR16 *)((UINT8 *)Entry->FileName + FileNameSize);
+    CopyMem (Entry->Prefix, Prefix, PrefixSize);
+  } else {
+    Entry->Prefix = NULL;
+  }
+
+  InsertHeadList (&mFileExistsCache, &Entry->Link);
+}
+
+VOID
+OcFileExistsCacheBegin (
+  VOID
+  )
+{
+  ++mFileExistsCacheDepth;
+}
+
+VOID
+OcFileExistsCacheEnd (
+  VOID
+  )
+{
+  LIST_ENTRY  *Link;
+
+  ASSERT (mFileExistsCacheDepth > 0);
+
+  if (--mFileExistsCacheDepth > 0) {
+    return;
+  }
+
+  while (!IsListEmpty (&mFileExistsCache)) {
+    Link = GetFirstNode (&mFileExistsCache);
+    RemoveEntryList (Link);
+    FreePool (OC_FILE_EXISTS_CACHE_ENTRY_FROM_LINK (Link));
+  }
+}
+
+EFI_STATUS
+OcFileExistsCached (
+  IN       EFI_HANDLE         Device    OPTIONAL,
+  IN CONST CHAR16             *Prefix   OPTIONAL,
+  IN CONST EFI_FILE_PROTOCOL  *Directory,
+  IN CONST CHAR16             *FileName
+  )
+{
+  EFI_STATUS                  Status;
+  EFI_FILE_PROTOCOL           *File;
+  LIST_ENTRY                  *Link;
+  OC_FILE_EXISTS_CACHE_ENTRY  *Entry;
+  BOOLEAN                     UseCache;
+
+  ASSERT (Directory != NULL);
+  ASSERT (FileName != NULL);
+
+  UseCache = mFileExistsCacheDepth > 0 && Device != NULL;
+
+  if (UseCache) {
+    for (Link = GetFirstNode (&mFileExistsCache); !IsNull (&mFileExistsCache, Link); Link = GetNextNode (&mFileExistsCache, Link)) {
+      Entry = OC_FILE_EXISTS_CACHE_ENTRY_FROM_LINK (Link);
+      if (InternalFileExistsCacheMatch (Entry, Device, Prefix, FileName)) {
+        return Entry->Status;
+      }
+    }
+  }
+
+  Status = OcSafeFileOpen (
+             Directory,
+             &File,
+             FileName,
+             EFI_FILE_MODE_READ,
+             0
+             );
+  if (!EFI_ERROR (Status)) {
+    File->Close (File);
+  }
+
+  //
+  // Do not remember transient failures.
+  //
+  if (UseCache && (Status != EFI_OUT_OF_RESOURCES)) {
+    InternalFileExistsCacheInsert (Device, Prefix, FileName, Status);
+  }
+
+  return Status;
+}
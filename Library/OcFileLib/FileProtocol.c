@@ -65,11 +65,39 @@ EfiTimeToEpoch (
   return EpochSeconds;
 }
 
+//
+// We are required to read in 1 MB portions on some firmware, because otherwise
+// systems namely MacBook7,1 will not read file data from APFS volumes but will
+// pretend they did. Reproduced with BootKernelExtensions.kc.
+//
+#define OC_FILE_READ_SLICE_SIZE  BASE_1MB
+
+//
+// Reads larger than this start with a probe of this size, which is read both
+// with a single Read call and in slices. It must span more than one slice.
+//
+#define OC_FILE_READ_PROBE_SIZE  (2 * OC_FILE_READ_SLICE_SIZE)
+
+//
+// Destinations above this address are read through a bounce buffer.
+//
+#define OC_FILE_READ_BOUNCE_LIMIT  BASE_4GB
+#define OC_FILE_READ_BOUNCE_SIZE   BASE_4MB
+
+//
+// Set once any file system returned wrong data for a single large read.
+// Broken drivers may only fail on some reads, so all further reads are
+// sliced for the rest of the boot.
+//
+STATIC BOOLEAN  mFileReadMismatchSeen;
+
+STATIC
 EFI_STATUS
-OcGetFileData (
+InternalGetFileDataSliced (
   IN  EFI_FILE_PROTOCOL  *File,
-  IN  UINT32             Position,
-  IN  UINT32             Size,
+  IN  UINT64             Position,
+  IN  UINTN              Size,
+  IN  UINTN              SliceSize,
   OUT UINT8              *Buffer
   )
 {
@@ -83,33 +111,205 @@ OcGetFileData (
       return Status;
     }
 
-    //
-    // We are required to read in 1 MB portions, because otherwise some
-    // systems namely MacBook7,1 will not read file data from APFS volumes
-    // but will pretend they did. Repeoduced with BootKernelExtensions.kc.
-    //
-    ReadSize = RequestedSize = MIN (Size, BASE_1MB);
+    ReadSize = RequestedSize = MIN (Size, SliceSize);
     Status   = File->Read (File, &ReadSize, Buffer);
     if (EFI_ERROR (Status)) {
-      File->SetPosition (File, 0);
       return Status;
     }
 
     if (ReadSize != RequestedSize) {
-      File->SetPosition (File, 0);
       return EFI_BAD_BUFFER_SIZE;
     }
 
-    Position += (UINT32)ReadSize;
+    Position += ReadSize;
     Buffer   += ReadSize;
-    Size     -= (UINT32)ReadSize;
+    Size     -= ReadSize;
   }
 
-  File->SetPosition (File, 0);
+  return EFI_SUCCESS;
+}
+
+/**
+  Read the first OC_FILE_READ_PROBE_SIZE bytes with a single Read call and
+  verify the driver really read them by poisoning the buffer and comparing
+  it against a sliced read. On mismatch the buffer is left with the sliced data.
+
+  @param[in]  File      File protocol to read from.
+  @param[in]  Position  Position to read from.
+  @param[out] Buffer    Buffer of at least OC_FILE_READ_PROBE_SIZE bytes.
+  @param[out] Verify    Scratch buffer of OC_FILE_READ_PROBE_SIZE bytes.
+  @param[out] Matched   Whether the single read returned the same data.
+
+  @retval EFI_SUCCESS  The buffer contains valid file data.
+**/
+STATIC
+EFI_STATUS
+InternalProbeLargeRead (
+  IN  EFI_FILE_PROTOCOL  *File,
+  IN  UINT64             Position,
+  OUT UINT8              *Buffer,
+  OUT UINT8              *Verify,
+  OUT BOOLEAN            *Matched
+  )
+{
+  EFI_STATUS  Status;
+  UINT32      Index;
+
+  *Matched = FALSE;
+
+  Status = InternalGetFileDataSliced (File, Position, OC_FILE_READ_PROBE_SIZE, OC_FILE_READ_SLICE_SIZE, Verify);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  for (Index = 0; Index < OC_FILE_READ_PROBE_SIZE; ++Index) {
+    Buffer[Index] = (UINT8)(Index * 0x9DU + 0x5AU);
+  }
+
+  Status = InternalGetFileDataSliced (File, Position, OC_FILE_READ_PROBE_SIZE, MAX_UINTN, Buffer);
+  if (!EFI_ERROR (Status) && (CompareMem (Buffer, Verify, OC_FILE_READ_PROBE_SIZE) == 0)) {
+    *Matched = TRUE;
+  } else {
+    CopyMem (Buffer, Verify, OC_FILE_READ_PROBE_SIZE);
+  }
 
   return EFI_SUCCESS;
 }
 
+/**
+  Read file data, probing whether single large reads work first.
+
+  @param[in]     File       File protocol to read from.
+  @param[in]     Position   Position to read from.
+  @param[in]     Size       Amount of bytes to read.
+  @param[out]    Buffer     Buffer to read into.
+  @param[in,out] SliceSize  Size of a single Read call, 0 when not yet probed.
+                            Reused to read the remaining parts of the same file.
+
+  @retval EFI_SUCCESS  The buffer contains valid file data.
+**/
+STATIC
+EFI_STATUS
+InternalGetFileData (
+  IN     EFI_FILE_PROTOCOL  *File,
+  IN     UINT64             Position,
+  IN     UINTN              Size,
+  OUT    UINT8              *Buffer,
+  IN OUT UINTN              *SliceSize
+  )
+{
+  EFI_STATUS  Status;
+  UINT8       *Verify;
+  BOOLEAN     Matched;
+
+  if (mFileReadMismatchSeen) {
+    *SliceSize = OC_FILE_READ_SLICE_SIZE;
+  }
+
+  if (*SliceSize == 0) {
+    //
+    // Small reads are sliced anyway, the probe is left to the next read.
+    //
+    if (Size <= OC_FILE_READ_PROBE_SIZE) {
+      return InternalGetFileDataSliced (File, Position, Size, OC_FILE_READ_SLICE_SIZE, Buffer);
+    }
+
+    *SliceSize = OC_FILE_READ_SLICE_SIZE;
+
+    Verify = AllocatePool (OC_FILE_READ_PROBE_SIZE);
+    if (Verify != NULL) {
+      Status = InternalProbeLargeRead (File, Position, Buffer, Verify, &Matched);
+      FreePool (Verify);
+      if (EFI_ERROR (Status)) {
+        return Status;
+      }
+
+      if (Matched) {
+        *SliceSize = MAX_UINTN;
+      } else {
+        DEBUG ((DEBUG_INFO, "OCFS: Large reads unreliable, using %u byte slices\n", OC_FILE_READ_SLICE_SIZE));
+        mFileReadMismatchSeen = TRUE;
+      }
+
+      Position += OC_FILE_READ_PROBE_SIZE;
+      Buffer   += OC_FILE_READ_PROBE_SIZE;
+      Size     -= OC_FILE_READ_PROBE_SIZE;
+    }
+  }
+
+  return InternalGetFileDataSliced (File, Position, Size, *SliceSize, Buffer);
+}
+
+EFI_STATUS
+OcGetFileData (
+  IN  EFI_FILE_PROTOCOL  *File,
+  IN  UINT32             Position,
+  IN  UINT32             Size,
+  OUT UINT8              *Buffer
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       SliceSize;
+
+  SliceSize = 0;
+  Status    = InternalGetFileData (File, Position, Size, Buffer, &SliceSize);
+
+  File->SetPosition (File, 0);
+
+  return Status;
+}
+
+EFI_STATUS
+OcGetFileDataToPages (
+  IN  EFI_FILE_PROTOCOL  *File,
+  IN  UINT64             Position,
+  IN  UINTN              Size,
+  OUT UINT8              *Buffer
+  )
+{
+  EFI_STATUS  Status;
+  UINT8       *BounceBuffer;
+  UINTN       ChunkSize;
+  UINTN       SliceSize;
+
+  SliceSize = 0;
+
+  if ((UINT64)(UINTN)Buffer + Size <= OC_FILE_READ_BOUNCE_LIMIT) {
+    Status = InternalGetFileData (File, Position, Size, Buffer, &SliceSize);
+    File->SetPosition (File, 0);
+    return Status;
+  }
+
+  //
+  // Several motherboards on APTIO IV, e.g. GA-Z77P-D3 (rev. 1.1), GA-Z87X-UD4H, etc.
+  // fail to read directly to high addresses when using FAT filesystem.
+  // REF: https://github.com/acidanthera/bugtracker/issues/449
+  //
+  BounceBuffer = AllocatePool (MIN (Size, OC_FILE_READ_BOUNCE_SIZE));
+  if (BounceBuffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = EFI_SUCCESS;
+  while (Size > 0) {
+    ChunkSize = MIN (Size, OC_FILE_READ_BOUNCE_SIZE);
+    Status    = InternalGetFileData (File, Position, ChunkSize, BounceBuffer, &SliceSize);
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+
+    CopyMem (Buffer, BounceBuffer, ChunkSize);
+
+    Position += ChunkSize;
+    Buffer   += ChunkSize;
+    Size     -= ChunkSize;
+  }
+
+  FreePool (BounceBuffer);
+  File->SetPosition (File, 0);
+  return Status;
+}
+
 EFI_STATUS
 OcGetFileSize (
   IN  EFI_FILE_PROTOCOL  *File,
@@ -231,85 +231,20 @@ OcKernelConfigureCapabilities (
 }
 
 STATIC
-VOID
-OcKernelLoadAndReserveKext (
+BOOLEAN
+OcKernelReadKext (
   IN     OC_KERNEL_ADD_ENTRY  *Kext,
-  IN     UINT32               Index,
   IN     BOOLEAN              IsForced,
   IN     EFI_FILE_PROTOCOL    *RootFile,
   IN     OC_STORAGE_CONTEXT   *Storage,
-  IN     OC_GLOBAL_CONFIG     *Config,
-  IN     KERNEL_CACHE_TYPE    CacheType,
-  IN     BOOLEAN              Is32Bit,
-  IN OUT UINT32               *ReservedExeSize,
-  IN OUT UINT32               *ReservedInfoSize,
-  IN OUT UINT32               *NumReservedKexts
+  IN     CONST CHAR8          *BundlePath,
+  IN     CONST CHAR8          *PlistPath,
+  IN     CONST CHAR8          *Comment
   )
 {
-  EFI_STATUS   Status;
-  CHAR8        *Identifier;
-  CHAR8        *BundlePath;
-  CHAR8        *Comment;
-  CONST CHAR8  *Arch;
-  CHAR8        *PlistPath;
-  CHAR8        *ExecutablePath;
-  CHAR16       FullPath[OC_STORAGE_SAFE_PATH_MAX];
-
-  if (!Kext->Enabled) {
-    return;
-  }
-
-  //
-  // Free existing data if present, but only for forced kexts.
-  // Injected kexts will never change.
-  //
-  if (IsForced && (Kext->PlistData != NULL)) {
-    FreePool (Kext->PlistData);
-    Kext->PlistDataSize = 0;
-    Kext->PlistData     = NULL;
-
-    if (Kext->ImageData != NULL) {
-      FreePool (Kext->ImageData);
-      Kext->ImageDataSize = 0;
-      Kext->ImageData     = NULL;
-    }
-  }
-
-  Identifier = OC_BLOB_GET (&Kext->Identifier);
-  BundlePath = OC_BLOB_GET (&Kext->BundlePath);
-  Comment    = OC_BLOB_GET (&Kext->Comment);
-  Arch       = OC_BLOB_GET (&Kext->Arch);
-  PlistPath  = OC_BLOB_GET (&Kext->PlistPath);
-  if ((BundlePath[0] == '\0') || (PlistPath[0] == '\0') || (IsForced && (Identifier[0] == '\0'))) {
-    DEBUG ((
-      DEBUG_ERROR,
-      "OC: %s kext %u (%a) has invalid info\n",
-      IsForced ? L"Forced" : L"Injected",
-      Index,
-      Comment
-      ));
-    Kext->Enabled = FALSE;
-    return;
-  }
-
-  if (AsciiStrCmp (Arch, Is32Bit ? "x86_64" : "i386") == 0) {
-    DEBUG ((
-      DEBUG_INFO,
-      "OC: %s kext %a (%a) at %u skipped due to arch %a != %a\n",
-      IsForced ? L"Forced" : L"Injected",
-      BundlePath,
-      Comment,
-      Index,
-      Arch,
-      Is32Bit ? "i386" : "x86_64"
-      ));
-    return;
-  }
-
-  //
-  // Required for possible cacheless force injection later on.
-  //
-  AsciiUefiSlashes (BundlePath);
+  EFI_STATUS  Status;
+  CHAR8       *ExecutablePath;
+  CHAR16      FullPath[OC_STORAGE_SAFE_PATH_MAX];
 
   //
   // Get plist path and data.
@@ -331,7 +266,7 @@ OcKernelLoadAndReserveKext (
       PlistPath
       ));
     Kext->Enabled = IsForced;
-    return;
+    return FALSE;
   }
 
   UnicodeUefiSlashes (FullPath);
@@ -361,7 +296,7 @@ OcKernelLoadAndReserveKext (
       Comment
       ));
     Kext->Enabled = IsForced;
-    return;
+    return FALSE;
   }
 
   //
@@ -388,7 +323,7 @@ OcKernelLoadAndReserveKext (
       Kext->Enabled = IsForced;
       FreePool (Kext->PlistData);
       Kext->PlistData = NULL;
-      return;
+      return FALSE;
     }
 
     UnicodeUefiSlashes (FullPath);
@@ -420,10 +355,100 @@ OcKernelLoadAndReserveKext (
       Kext->Enabled = IsForced;
       FreePool (Kext->PlistData);
       Kext->PlistData = NULL;
-      return;
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
+STATIC
+VOID
+OcKernelLoadAndReserveKext (
+  IN     OC_KERNEL_ADD_ENTRY  *Kext,
+  IN     UINT32               Index,
+  IN     BOOLEAN              IsForced,
+  IN     EFI_FILE_PROTOCOL    *RootFile,
+  IN     OC_STORAGE_CONTEXT   *Storage,
+  IN     OC_GLOBAL_CONFIG     *Config,
+  IN     KERNEL_CACHE_TYPE    CacheType,
+  IN     BOOLEAN              Is32Bit,
+  IN OUT UINT32               *ReservedExeSize,
+  IN OUT UINT32               *ReservedInfoSize,
+  IN OUT UINT32               *NumReservedKexts
+  )
+{
+  EFI_STATUS   Status;
+  CHAR8        *Identifier;
+  CHAR8        *BundlePath;
+  CHAR8        *Comment;
+  CONST CHAR8  *Arch;
+  CHAR8        *PlistPath;
+
+  if (!Kext->Enabled) {
+    return;
+  }
+
+  //
+  // Free existing data if present, but only for forced kexts.
+  // Injected kexts will never change.
+  //
+  if (IsForced && (Kext->PlistData != NULL)) {
+    FreePool (Kext->PlistData);
+    Kext->PlistDataSize = 0;
+    Kext->PlistData     = NULL;
+
+    if (Kext->ImageData != NULL) {
+      FreePool (Kext->ImageData);
+      Kext->ImageDataSize = 0;
+      Kext->ImageData     = NULL;
     }
   }
 
+  Identifier = OC_BLOB_GET (&Kext->Identifier);
+  BundlePath = OC_BLOB_GET (&Kext->BundlePath);
+  Comment    = OC_BLOB_GET (&Kext->Comment);
+  Arch       = OC_BLOB_GET (&Kext->Arch);
+  PlistPath  = OC_BLOB_GET (&Kext->PlistPath);
+  if ((BundlePath[0] == '\0') || (PlistPath[0] == '\0') || (IsForced && (Identifier[0] == '\0'))) {
+    DEBUG ((
+      DEBUG_ERROR,
+      "OC: %s kext %u (%a) has invalid info\n",
+      IsForced ? L"Forced" : L"Injected",
+      Index,
+      Comment
+      ));
+    Kext->Enabled = FALSE;
+    return;
+  }
+
+  if (AsciiStrCmp (Arch, Is32Bit ? "x86_64" : "i386") == 0) {
+    DEBUG ((
+      DEBUG_INFO,
+      "OC: %s kext %a (%a) at %u skipped due to arch %a != %a\n",
+      IsForced ? L"Forced" : L"Injected",
+      BundlePath,
+      Comment,
+      Index,
+      Arch,
+      Is32Bit ? "i386" : "x86_64"
+      ));
+    return;
+  }
+
+  //
+  // Required for possible cacheless force injection later on.
+  //
+  AsciiUefiSlashes (BundlePath);
+
+  //
+  // Injected kexts will never change, so only read them once and reuse
+  // the data during subsequent reservations (e.g. fuzzy kernel matching).
+  //
+  if ((Kext->PlistData == NULL) && !OcKernelReadKext (Kext, IsForced, RootFile, Storage, BundlePath, PlistPath, Comment)) {
+    return;
+  }
+
   if ((CacheType == CacheTypeCacheless) || (CacheType == CacheTypeMkext)) {
     Status = MkextReserveKextSize (
                ReservedInfoSize,
@@ -342,6 +342,112 @@ InternalApplyRelocation (
   return RETURN_SUCCESS;
 }
 
+/**
+  Checks whether every Base Relocation target of a Block is in bounds and does
+  not overlap with the Relocation Directory, for any offset and type.
+
+  @param[in] Context      The context describing the Image. Must have been
+                          loaded by PeCoffLoadImage().
+  @param[in] BlockAddress The VirtualAddress of the Base Relocation Block.
+
+  @returns  Whether per-Relocation target checks may be skipped for the Block.
+**/
+STATIC
+BOOLEAN
+InternalIsRelocationPageSafe (
+  IN CONST PE_COFF_IMAGE_CONTEXT  *Context,
+  IN UINT32                       BlockAddress
+  )
+{
+  BOOLEAN  Result;
+  UINT32   BlockTop;
+
+  //
+  // The widest fixup is 8 bytes at the largest encodable offset.
+  //
+  Result = BaseOverflowAddU32 (
+             BlockAddress,
+             IMAGE_RELOC_OFFSET (MAX_UINT16) + sizeof (UINT64),
+             &BlockTop
+             );
+  if (Result || (BlockTop > Context->SizeOfImage)) {
+    return FALSE;
+  }
+
+  return BlockTop <= Context->RelocDirRva
+         || Context->RelocDirRva + Context->RelocDirSize <= BlockAddress;
+}
+
+/**
+  Apply all Base Relocations of a Block that passed
+  InternalIsRelocationPageSafe(). DIR64 fixups, which make up virtually all
+  Base Relocations of 64-bit Images, are applied without further checks.
+  Other types are applied by InternalApplyRelocation().
+
+  @param[in]  Context     The context describing the Image. Must have been
+                          loaded by PeCoffLoadImage().
+  @param[in]  RelocBlock  The Base Relocation Block to apply.
+  @param[in]  NumRelocs   The number of Base Relocations in RelocBlock.
+  @param[in]  Adjust      The delta to add to the addresses.
+  @param[out] FixupData   On input, a pointer to the bookkeeping values of the
+                          Block or NULL.
+                          On output, the values to preserve for Runtime
+                          Relocation.
+
+  @retval RETURN_SUCCESS  The Base Relocations have been applied successfully.
+  @retval other           The Base Relocations could not be applied
+                          successfully.
+**/
+STATIC
+RETURN_STATUS
+InternalApplyRelocationBlock (
+  IN  CONST PE_COFF_IMAGE_CONTEXT            *Context,
+  IN  CONST EFI_IMAGE_BASE_RELOCATION_BLOCK  *RelocBlock,
+  IN  UINT32                                 NumRelocs,
+  IN  UINT64                                 Adjust,
+  OUT UINT64                                 *FixupData OPTIONAL
+  )
+{
+  RETURN_STATUS  Status;
+  UINT32         RelocIndex;
+  UINT16         Relocation;
+  CHAR8          *Page;
+  CHAR8          *Fixup;
+  UINT64         Fixup64;
+
+  Page = (CHAR8 *)Context->ImageBuffer + RelocBlock->VirtualAddress;
+
+  for (RelocIndex = 0; RelocIndex < NumRelocs; ++RelocIndex) {
+    Relocation = RelocBlock->Relocations[RelocIndex];
+
+    if (IMAGE_RELOC_TYPE (Relocation) == EFI_IMAGE_REL_BASED_DIR64) {
+      Fixup    = Page + IMAGE_RELOC_OFFSET (Relocation);
+      Fixup64  = ReadUnaligned64 ((CONST VOID *)Fixup);
+      Fixup64 += Adjust;
+      WriteUnaligned64 ((VOID *)Fixup, Fixup64);
+
+      if (FixupData != NULL) {
+        FixupData[RelocIndex] = Fixup64;
+      }
+
+      continue;
+    }
+
+    Status = InternalApplyRelocation (
+               Context,
+               RelocBlock,
+               RelocIndex,
+               Adjust,
+               FixupData
+               );
+    if (Status != RETURN_SUCCESS) {
+      return Status;
+    }
+  }
+
+  return RETURN_SUCCESS;
+}
+
 RETURN_STATUS
 PeCoffRelocateImage (
   IN  CONST PE_COFF_IMAGE_CONTEXT  *Context,
@@ -447,6 +553,27 @@ PeCoffRelocateImage (
       WalkerFixupData = NULL;
     }
 
+    //
+    // Blocks with all targets in bounds are processed by the batched path,
+    // which only checks the Base Relocation type of every entry.
+    //
+    if (InternalIsRelocationPageSafe (Context, RelocWalker->VirtualAddress)) {
+      Status = InternalApplyRelocationBlock (
+                 Context,
+                 RelocWalker,
+                 NumRelocs,
+                 Adjust,
+                 WalkerFixupData
+                 );
+      if (Status != RETURN_SUCCESS) {
+        return Status;
+      }
+
+      RelocDataIndex += NumRelocs;
+      RelocOffset    += RelocWalker->SizeOfBlock;
+      continue;
+    }
+
     //
     // Process all Base Relocations of the current Block.
     //
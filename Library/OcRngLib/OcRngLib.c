@@ -84,11 +84,10 @@ ChaChaRngStir (
   // Reinitialize if we are making a second loop.
   //
   if (mRng.PrngInitialised) {
-    ZeroMem (mRng.Buffer, sizeof (mRng.Buffer));
     //
     // Fill buffer with keystream.
     //
-    ChaChaCryptBuffer (&mRng.ChaCha, mRng.Buffer, mRng.Buffer, sizeof (mRng.Buffer));
+    ChaChaGenerateKeystream (&mRng.ChaCha, mRng.Buffer, sizeof (mRng.Buffer));
     //
     // Mix in RNG data.
     //
@@ -143,11 +142,10 @@ ChaChaRngGenerate (
     }
 
     if (mRng.BytesInBuffer == 0) {
-      ZeroMem (mRng.Buffer, sizeof (mRng.Buffer));
       //
       // Fill buffer with keystream.
       //
-      ChaChaCryptBuffer (&mRng.ChaCha, mRng.Buffer, mRng.Buffer, sizeof (mRng.Buffer));
+      ChaChaGenerateKeystream (&mRng.ChaCha, mRng.Buffer, sizeof (mRng.Buffer));
       //
       // Immediately reinit for backtracking resistance.
       //
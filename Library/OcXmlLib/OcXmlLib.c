@@ -47,11 +47,6 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 #include <Library/OcMiscLib.h>
 #include <Library/OcStringLib.h>
 
-/**
-  Minimal extra allocation size during export.
-**/
-#define XML_EXPORT_MIN_ALLOCATION_SIZE  4096
-
 #define XML_PLIST_HEADER  "<?xml version=\"1.0\" encoding=\"UTF-8\"?><!DOCTYPE plist PUBLIC \"-//Apple//DTD PLIST 1.0//EN\" \"http://www.apple.com/DTDs/PropertyList-1.0.dtd\">"
 
 struct XML_NODE_LIST_;
@@ -62,7 +57,9 @@ typedef struct XML_PARSER_     XML_PARSER;
 
 /**
   An XML_NODE will always contain a tag name and possibly a list of
-  children or text content.
+  children or text content. Nodes parsed from a document with preserved
+  source also reference their original text, SourceLength is 0 when
+  the node was created or modified after parsing.
 **/
 struct XML_NODE_ {
   CONST CHAR8      *Name;
@@ -70,6 +67,8 @@ struct XML_NODE_ {
   CONST CHAR8      *Content;
   XML_NODE         *Real;
   XML_NODE_LIST    *Children;
+  UINT32           SourceOffset;
+  UINT32           SourceLength;
 };
 
 struct XML_NODE_LIST_ {
@@ -86,6 +85,7 @@ typedef struct {
 
 /**
   An XML_DOCUMENT simply contains the root node and the underlying buffer.
+  Source optionally holds an unmodified copy of the buffer.
 **/
 struct XML_DOCUMENT_ {
   struct {
@@ -93,10 +93,24 @@ struct XML_DOCUMENT_ {
     UINT32    Length;
   } Buffer;
 
+  CHAR8          *Source;
+
   XML_NODE       *Root;
   XML_REFLIST    References;
 };
 
+/**
+  Export buffer context. When Buffer is NULL, only the size is computed.
+  When Source is not NULL, unmodified nodes are copied from it verbatim.
+**/
+typedef struct {
+  CONST CHAR8    *Source;
+  CHAR8          *Buffer;
+  UINT32         AllocSize;
+  UINT32         CurrentSize;
+  BOOLEAN        Overflow;
+} XML_EXPORT_BUFFER;
+
 /**
   Parser context.
 **/
@@ -214,11 +228,13 @@ XmlNodeCreate (
   Node = AllocatePool (sizeof (XML_NODE));
 
   if (Node != NULL) {
-    Node->Name       = Name;
-    Node->Attributes = Attributes;
-    Node->Content    = Content;
-    Node->Real       = Real;
-    Node->Children   = Children;
+    Node->Name         = Name;
+    Node->Attributes   = Attributes;
+    Node->Content      = Content;
+    Node->Real         = Real;
+    Node->Children     = Children;
+    Node->SourceOffset = 0;
+    Node->SourceLength = 0;
   }
 
   return Node;
@@ -1005,123 +1021,153 @@ XmlParseContent (
 }
 
 /**
-  Print to growing buffer always preserving one byte extra.
+  Append data to export buffer always preserving one byte extra.
+  When Buffer->Buffer is NULL only the resulting size is computed.
 
-  @param[in,out]  Buffer       A pointer to the buffer holding contents.
-  @param[in,out]  AllocSize    Size of Buffer to be allocated.
-  @param[in,out]  CurrentSize  Current size of Buffer before appending.
+  @param[in,out]  Buffer       Export buffer context.
   @param[in]      Data         Data to be appended.
   @param[in]      DataLength   Length of Data.
 **/
 STATIC
 VOID
 XmlBufferAppend (
-  IN OUT  CHAR8        **Buffer,
-  IN OUT  UINT32       *AllocSize,
-  IN OUT  UINT32       *CurrentSize,
-  IN      CONST CHAR8  *Data,
-  IN      UINT32       DataLength
+  IN OUT  XML_EXPORT_BUFFER  *Buffer,
+  IN      CONST CHAR8        *Data,
+  IN      UINT32             DataLength
   )
 {
-  CHAR8   *NewBuffer;
   UINT32  NewSize;
 
-  ASSERT (Buffer      != NULL);
-  ASSERT (AllocSize   != NULL);
-  ASSERT (CurrentSize != NULL);
-  ASSERT (Data        != NULL);
+  ASSERT (Buffer != NULL);
+  ASSERT (Data   != NULL);
 
-  NewSize = *AllocSize;
+  if (Buffer->Overflow) {
+    return;
+  }
 
-  if (NewSize - *CurrentSize <= DataLength) {
-    if (DataLength + 1 <= XML_EXPORT_MIN_ALLOCATION_SIZE) {
-      NewSize += XML_EXPORT_MIN_ALLOCATION_SIZE;
-    } else {
-      NewSize += DataLength + 1;
-    }
+  if (OcOverflowAddU32 (Buffer->CurrentSize, DataLength, &NewSize)) {
+    Buffer->Overflow = TRUE;
+    return;
+  }
 
-    NewBuffer = AllocatePool (NewSize);
-    if (NewBuffer == NULL) {
-      XML_USAGE_ERROR ("XmlBufferAppend::failed to allocate");
+  if (Buffer->Buffer != NULL) {
+    if (NewSize >= Buffer->AllocSize) {
+      Buffer->Overflow = TRUE;
       return;
     }
 
-    CopyMem (NewBuffer, *Buffer, *CurrentSize);
-    FreePool (*Buffer);
-    *Buffer    = NewBuffer;
-    *AllocSize = NewSize;
+    CopyMem (&Buffer->Buffer[Buffer->CurrentSize], Data, DataLength);
   }
 
-  CopyMem (&(*Buffer)[*CurrentSize], Data, DataLength);
-  *CurrentSize += DataLength;
+  Buffer->CurrentSize = NewSize;
 }
 
 /**
-  Print node to growing buffer always preserving one byte extra.
+  Print node to export buffer always preserving one byte extra.
 
   @param[in]      Node         A pointer to the XML node.
-  @param[in,out]  Buffer       A pointer to the buffer holding contents exported.
-  @param[in,out]  AllocSize    Size of Buffer to be allocated.
-  @param[in,out]  CurrentSize  Current size of Buffer.
+  @param[in,out]  Buffer       Export buffer context.
   @param[in]      Skip         Levels of XML contents to be skipped.
 **/
 STATIC
 VOID
 XmlNodeExportRecursive (
-  IN      CONST XML_NODE  *Node,
-  IN OUT  CHAR8           **Buffer,
-  IN OUT  UINT32          *AllocSize,
-  IN OUT  UINT32          *CurrentSize,
-  IN      UINT32          Skip
+  IN      CONST XML_NODE     *Node,
+  IN OUT  XML_EXPORT_BUFFER  *Buffer,
+  IN      UINT32             Skip
   )
 {
   UINT32  Index;
   UINT32  NameLength;
 
-  ASSERT (Node        != NULL);
-  ASSERT (Buffer      != NULL);
-  ASSERT (AllocSize   != NULL);
-  ASSERT (CurrentSize != NULL);
+  ASSERT (Node   != NULL);
+  ASSERT (Buffer != NULL);
 
   if (Skip != 0) {
     if (Node->Children != NULL) {
       for (Index = 0; Index < Node->Children->NodeCount; ++Index) {
-        XmlNodeExportRecursive (Node->Children->NodeList[Index], Buffer, AllocSize, CurrentSize, Skip - 1);
+        XmlNodeExportRecursive (Node->Children->NodeList[Index], Buffer, Skip - 1);
       }
     }
 
     return;
   }
 
+  //
+  // Unmodified nodes are copied from the original source as is.
+  //
+  if ((Buffer->Source != NULL) && (Node->SourceLength != 0)) {
+    XmlBufferAppend (Buffer, &Buffer->Source[Node->SourceOffset], Node->SourceLength);
+    return;
+  }
+
   NameLength = (UINT32)AsciiStrLen (Node->Name);
 
-  XmlBufferAppend (Buffer, AllocSize, CurrentSize, "<", L_STR_LEN ("<"));
-  XmlBufferAppend (Buffer, AllocSize, CurrentSize, Node->Name, NameLength);
+  XmlBufferAppend (Buffer, "<", L_STR_LEN ("<"));
+  XmlBufferAppend (Buffer, Node->Name, NameLength);
 
   if (Node->Attributes != NULL) {
-    XmlBufferAppend (Buffer, AllocSize, CurrentSize, " ", L_STR_LEN (" "));
-    XmlBufferAppend (Buffer, AllocSize, CurrentSize, Node->Attributes, (UINT32)AsciiStrLen (Node->Attributes));
+    XmlBufferAppend (Buffer, " ", L_STR_LEN (" "));
+    XmlBufferAppend (Buffer, Node->Attributes, (UINT32)AsciiStrLen (Node->Attributes));
   }
 
   if ((Node->Children != NULL) || (Node->Content != NULL)) {
-    XmlBufferAppend (Buffer, AllocSize, CurrentSize, ">", L_STR_LEN (">"));
+    XmlBufferAppend (Buffer, ">", L_STR_LEN (">"));
 
     if (Node->Children != NULL) {
       for (Index = 0; Index < Node->Children->NodeCount; ++Index) {
-        XmlNodeExportRecursive (Node->Children->NodeList[Index], Buffer, AllocSize, CurrentSize, 0);
+        XmlNodeExportRecursive (Node->Children->NodeList[Index], Buffer, 0);
       }
     } else {
-      XmlBufferAppend (Buffer, AllocSize, CurrentSize, Node->Content, (UINT32)AsciiStrLen (Node->Content));
+      XmlBufferAppend (Buffer, Node->Content, (UINT32)AsciiStrLen (Node->Content));
     }
 
-    XmlBufferAppend (Buffer, AllocSize, CurrentSize, "</", L_STR_LEN ("</"));
-    XmlBufferAppend (Buffer, AllocSize, CurrentSize, Node->Name, NameLength);
-    XmlBufferAppend (Buffer, AllocSize, CurrentSize, ">", L_STR_LEN (">"));
+    XmlBufferAppend (Buffer, "</", L_STR_LEN ("</"));
+    XmlBufferAppend (Buffer, Node->Name, NameLength);
+    XmlBufferAppend (Buffer, ">", L_STR_LEN (">"));
   } else {
-    XmlBufferAppend (Buffer, AllocSize, CurrentSize, "/>", L_STR_LEN ("/>"));
+    XmlBufferAppend (Buffer, "/>", L_STR_LEN ("/>"));
   }
 }
 
+/**
+  Drop original source references from nodes with modified descendants.
+
+  @param[in,out]  Node  A pointer to the XML node.
+
+  @retval  TRUE if the node can be exported from the original source.
+**/
+STATIC
+BOOLEAN
+XmlNodeRefreshSource (
+  IN OUT  XML_NODE  *Node
+  )
+{
+  UINT32   Index;
+  BOOLEAN  Unmodified;
+
+  ASSERT (Node != NULL);
+
+  Unmodified = Node->SourceLength != 0;
+
+  //
+  // All children must be visited, as any of them may have modified descendants.
+  //
+  if (Node->Children != NULL) {
+    for (Index = 0; Index < Node->Children->NodeCount; ++Index) {
+      if (!XmlNodeRefreshSource (Node->Children->NodeList[Index])) {
+        Unmodified = FALSE;
+      }
+    }
+  }
+
+  if (!Unmodified) {
+    Node->SourceLength = 0;
+  }
+
+  return Unmodified;
+}
+
 /**
   Parse an XML fragment node.
 
@@ -1155,6 +1201,8 @@ XmlParseNode (
   XML_NODE     *Node;
   XML_NODE     *Child;
   UINT32       ReferenceNumber;
+  UINT32       NodeStart;
+  UINT32       NodeEnd;
   BOOLEAN      IsReference;
   BOOLEAN      SelfClosing;
   BOOLEAN      Unprefixed;
@@ -1182,6 +1230,12 @@ XmlParseNode (
     return NULL;
   }
 
+  //
+  // Tag name directly follows `<'.
+  //
+  NodeStart = (UINT32)(TagOpen - Parser->Buffer) - 1;
+  NodeEnd   = Parser->Position;
+
   XmlSkipWhitespace (Parser);
 
   Node = XmlNodeCreate (TagOpen, Attributes, NULL, XmlNodeReal (References, Attributes), NULL);
@@ -1194,6 +1248,8 @@ XmlParseNode (
   // If tag ends with `/' it's self closing, skip content lookup.
   //
   if (SelfClosing) {
+    Node->SourceOffset = NodeStart;
+    Node->SourceLength = NodeEnd - NodeStart;
     return Node;
   }
 
@@ -1301,6 +1357,9 @@ XmlParseNode (
     return NULL;
   }
 
+  Node->SourceOffset = NodeStart;
+  Node->SourceLength = Parser->Position - NodeStart;
+
   return Node;
 }
 
@@ -1357,76 +1416,168 @@ XmlDocumentParse (
 
   Document->Buffer.Buffer = Buffer;
   Document->Buffer.Length = Length;
+  Document->Source        = NULL;
   Document->Root          = Root;
   CopyMem (&Document->References, &References, sizeof (References));
 
   return Document;
 }
 
-CHAR8 *
-XmlDocumentExport (
+XML_DOCUMENT *
+XmlDocumentParseWithSource (
+  IN OUT  CHAR8    *Buffer,
+  IN      UINT32   Length,
+  IN      BOOLEAN  WithRefs
+  )
+{
+  XML_DOCUMENT  *Document;
+  CHAR8         *Source;
+
+  ASSERT (Buffer != NULL);
+
+  if ((Length == 0) || (Length > XML_PARSER_MAX_SIZE)) {
+    return NULL;
+  }
+
+  //
+  // Parsing modifies the buffer, preserve the original contents for export.
+  //
+  Source = AllocateCopyPool (Length, Buffer);
+  if (Source == NULL) {
+    XML_USAGE_ERROR ("XmlDocumentParseWithSource::failed to allocate");
+    return NULL;
+  }
+
+  Document = XmlDocumentParse (Buffer, Length, WithRefs);
+  if (Document == NULL) {
+    FreePool (Source);
+    return NULL;
+  }
+
+  Document->Source = Source;
+
+  return Document;
+}
+
+BOOLEAN
+XmlDocumentExportSize (
   IN   CONST XML_DOCUMENT  *Document,
+  OUT  UINT32              *Length,
+  IN   UINT32              Skip,
+  IN   BOOLEAN             PrependPlistInfo
+  )
+{
+  XML_EXPORT_BUFFER  Buffer;
+
+  ASSERT (Document != NULL);
+  ASSERT (Length   != NULL);
+
+  ZeroMem (&Buffer, sizeof (Buffer));
+
+  if (Document->Source != NULL) {
+    XmlNodeRefreshSource (Document->Root);
+    Buffer.Source = Document->Source;
+  }
+
+  if (PrependPlistInfo) {
+    XmlBufferAppend (&Buffer, XML_PLIST_HEADER, L_STR_LEN (XML_PLIST_HEADER));
+  }
+
+  XmlNodeExportRecursive (Document->Root, &Buffer, Skip);
+
+  //
+  // Reserve space for the null terminator.
+  //
+  if (Buffer.Overflow || (Buffer.CurrentSize == MAX_UINT32)) {
+    return FALSE;
+  }
+
+  *Length = Buffer.CurrentSize;
+  return TRUE;
+}
+
+BOOLEAN
+XmlDocumentExportToBuffer (
+  IN   CONST XML_DOCUMENT  *Document,
+  OUT  CHAR8               *Buffer,
+  IN   UINT32              BufferSize,
   OUT  UINT32              *Length  OPTIONAL,
   IN   UINT32              Skip,
   IN   BOOLEAN             PrependPlistInfo
   )
 {
-  CHAR8   *Buffer;
-  CHAR8   *NewBuffer;
-  UINT32  AllocSize;
-  UINT32  CurrentSize;
-  UINT32  NewSize;
+  XML_EXPORT_BUFFER  Export;
 
   ASSERT (Document != NULL);
+  ASSERT (Buffer   != NULL);
 
-  AllocSize = Document->Buffer.Length + 1;
-  Buffer    = AllocatePool (AllocSize);
-  if (Buffer == NULL) {
-    XML_USAGE_ERROR ("XmlDocumentExport::failed to allocate");
-    return NULL;
+  if (BufferSize == 0) {
+    return FALSE;
   }
 
-  CurrentSize = 0;
-  XmlNodeExportRecursive (Document->Root, &Buffer, &AllocSize, &CurrentSize, Skip);
+  if (Document->Source != NULL) {
+    XmlNodeRefreshSource (Document->Root);
+  }
 
-  if (PrependPlistInfo) {
-    //
-    // XmlNodeExportRecursive returns a size that does not include the null terminator,
-    // but the allocated buffer does. During this reallocation, we count the null terminator
-    // of the plist header instead to ensure allocated buffer is the proper size.
-    //
-    if (OcOverflowAddU32 (CurrentSize, L_STR_SIZE (XML_PLIST_HEADER), &NewSize)) {
-      FreePool (Buffer);
-      return NULL;
-    }
+  Export.Source      = Document->Source;
+  Export.Buffer      = Buffer;
+  Export.AllocSize   = BufferSize;
+  Export.CurrentSize = 0;
+  Export.Overflow    = FALSE;
 
-    NewBuffer = AllocatePool (NewSize);
-    if (NewBuffer == NULL) {
-      FreePool (Buffer);
-      XML_USAGE_ERROR ("XmlDocumentExport::failed to allocate");
-      return NULL;
-    }
+  if (PrependPlistInfo) {
+    XmlBufferAppend (&Export, XML_PLIST_HEADER, L_STR_LEN (XML_PLIST_HEADER));
+  }
 
-    CopyMem (NewBuffer, XML_PLIST_HEADER, L_STR_SIZE_NT (XML_PLIST_HEADER));
-    CopyMem (&NewBuffer[L_STR_LEN (XML_PLIST_HEADER)], Buffer, CurrentSize);
-    FreePool (Buffer);
+  XmlNodeExportRecursive (Document->Root, &Export, Skip);
 
-    //
-    // Null terminator is not included in size returned by XmlBufferAppend.
-    //
-    CurrentSize = NewSize - 1;
-    Buffer      = NewBuffer;
+  if (Export.Overflow) {
+    return FALSE;
   }
 
+  //
+  // Null terminator is not included in CurrentSize,
+  // but XmlBufferAppend always preserves space for it.
+  //
+  Buffer[Export.CurrentSize] = '\0';
+
   if (Length != NULL) {
-    *Length = CurrentSize;
+    *Length = Export.CurrentSize;
   }
 
+  return TRUE;
+}
+
+CHAR8 *
+XmlDocumentExport (
+  IN   CONST XML_DOCUMENT  *Document,
+  OUT  UINT32              *Length  OPTIONAL,
+  IN   UINT32              Skip,
+  IN   BOOLEAN             PrependPlistInfo
+  )
+{
+  CHAR8   *Buffer;
+  UINT32  ExportSize;
+
+  ASSERT (Document != NULL);
+
   //
-  // Null terminator is not included in size returned by XmlBufferAppend,
-  // but the buffer is allocated to include it.
+  // Compute the exact size first to avoid reallocations during export.
   //
-  Buffer[CurrentSize] = '\0';
+  if (!XmlDocumentExportSize (Document, &ExportSize, Skip, PrependPlistInfo)) {
+    return NULL;
+  }
+
+  Buffer = AllocatePool (ExportSize + 1);
+  if (Buffer == NULL) {
+    XML_USAGE_ERROR ("XmlDocumentExport::failed to allocate");
+    return NULL;
+  }
+
+  if (!XmlDocumentExportToBuffer (Document, Buffer, ExportSize + 1, Length, Skip, PrependPlistInfo)) {
+    FreePool (Buffer);
+    return NULL;
+  }
 
   return Buffer;
 }
@@ -1440,6 +1591,10 @@ XmlDocumentFree (
 
   XmlNodeFree (Document->Root);
   XmlFreeRefs (&Document->References);
+  if (Document->Source != NULL) {
+    FreePool (Document->Source);
+  }
+
   FreePool (Document);
 }
 
@@ -1483,10 +1638,12 @@ XmlNodeChangeContent (
   ASSERT (Content != NULL);
 
   if (Node->Real != NULL) {
-    Node->Real->Content = Content;
+    Node->Real->Content      = Content;
+    Node->Real->SourceLength = 0;
   }
 
-  Node->Content = Content;
+  Node->Content      = Content;
+  Node->SourceLength = 0;
 }
 
 UINT32
@@ -1600,6 +1757,8 @@ XmlNodeAppend (
     return NULL;
   }
 
+  Node->SourceLength = 0;
+
   return NewNode;
 }
 
@@ -1658,6 +1817,8 @@ XmlNodeRemoveByIndex (
   //
   ZeroMem (&Node->Children->NodeList[Node->Children->NodeCount-1], sizeof (*Node->Children->NodeList));
   --Node->Children->NodeCount;
+
+  Node->SourceLength = 0;
 }
 
 VOID
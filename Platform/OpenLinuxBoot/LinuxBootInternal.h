@@ -142,6 +142,11 @@ extern OC_FLEX_ARRAY  *gLoaderEntries;
 */
 extern EFI_GUID  gPartuuid;
 
+/*
+  The current device handle.
+*/
+extern EFI_HANDLE  gDeviceHandle;
+
 /*
   Human readable ascii name of current file system type.
 */
@@ -610,12 +610,11 @@ FindLoaderFile (
   IN OUT       CHAR8            **FileName
   )
 {
-  EFI_STATUS         Status;
-  EFI_FILE_PROTOCOL  *File;
-  UINTN              FileNameLen;
-  UINTN              DirNameLen;
-  CHAR16             *Path;
-  UINTN              MaxPathSize;
+  EFI_STATUS  Status;
+  UINTN       FileNameLen;
+  UINTN       DirNameLen;
+  CHAR16      *Path;
+  UINTN       MaxPathSize;
 
   ASSERT (DirName != NULL);
   ASSERT (FileName != NULL);
@@ -634,9 +633,8 @@ FindLoaderFile (
   UnicodeSPrintAsciiFormat (Path, MaxPathSize, "%a", *FileName);
   UnicodeUefiSlashes (Path);
 
-  Status = OcSafeFileOpen (Directory, &File, Path, EFI_FILE_MODE_READ, 0);
+  Status = OcFileExistsCached (gDeviceHandle, DirName, Directory, Path);
   if (!EFI_ERROR (Status)) {
-    File->Close (File);
     FreePool (Path);
     return Status;
   }
@@ -650,12 +648,11 @@ FindLoaderFile (
   UnicodeSPrintAsciiFormat (Path, MaxPathSize, "%s%a", DirName, *FileName);
   UnicodeUefiSlashes (Path);
 
-  Status = OcSafeFileOpen (Directory, &File, Path, EFI_FILE_MODE_READ, 0);
+  Status = OcFileExistsCached (gDeviceHandle, DirName, Directory, Path);
   if (!EFI_ERROR (Status)) {
     //
     // Found at 'wrong' location - re-use allocated path
     //
-    File->Close (File);
     AsciiSPrint ((CHAR8 *)Path, MaxPathSize, "%s%a", DirName, *FileName);
     AsciiUnixSlashes ((CHAR8 *)Path);
     FreePool (*FileName);
@@ -28,6 +28,7 @@ STATIC OC_FLEX_ARRAY  *mParsedLoadOptions;
 OC_PICKER_CONTEXT  *gPickerContext;
 OC_FLEX_ARRAY      *gLoaderEntries;
 EFI_GUID           gPartuuid;
+EFI_HANDLE         gDeviceHandle;
 CHAR8              *gFileSystemType;
 
 VOID
@@ -121,6 +122,8 @@ OcGetLinuxBootEntries (
     return EFI_NOT_FOUND;
   }
 
+  gDeviceHandle = Device;
+
   //
   // Open partition file system.
   //
@@ -228,6 +231,11 @@ OcGetLinuxBootEntries (
     &gPartuuid
     ));
 
+  //
+  // Entries frequently share kernel and initrd files, probe each path once.
+  //
+  OcFileExistsCacheBegin ();
+
   //
   // Scan for boot loader spec & blscfg entries (Fedora-like).
   //
@@ -255,6 +263,8 @@ OcGetLinuxBootEntries (
                );
   }
 
+  OcFileExistsCacheEnd ();
+
   RootDirectory->Close (RootDirectory);
 
   return Status;
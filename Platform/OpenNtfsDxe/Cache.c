@@ -0,0 +1,283 @@
+/** @file
+  Per-volume caches of fixed-up FILE Records and decoded Runlists.
+  The driver is read-only, so cached entries never become stale
+  while the volume is mounted and are only dropped on eviction.
+
+  Copyright (c) 2023, Acidanthera. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-3-Clause
+**/
+
+#include "NTFS.h"
+#include "Helper.h"
+
+BOOLEAN
+MftCacheLookup (
+  IN  EFI_FS  *FileSystem,
+  IN  UINT64  RecordNumber,
+  OUT UINT8   *Buffer
+  )
+{
+  UINTN  Index;
+
+  ASSERT (FileSystem != NULL);
+  ASSERT (Buffer != NULL);
+
+  for (Index = 0; Index < MFT_CACHE_SIZE; ++Index) {
+    if (  (FileSystem->MftCache[Index].FileRecord != NULL)
+       && (FileSystem->MftCache[Index].RecordNumber == RecordNumber))
+    {
+      FileSystem->MftCache[Index].LastUsed = ++FileSystem->CacheTick;
+      CopyMem (Buffer, FileSystem->MftCache[Index].FileRecord, FileSystem->FileRecordSize);
+      return TRUE;
+    }
+  }
+
+  return FALSE;
+}
+
+VOID
+MftCacheInsert (
+  IN EFI_FS       *FileSystem,
+  IN UINT64       RecordNumber,
+  IN CONST UINT8  *Buffer
+  )
+{
+  UINTN            Index;
+  MFT_CACHE_ENTRY  *Victim;
+
+  ASSERT (FileSystem != NULL);
+  ASSERT (Buffer != NULL);
+
+  Victim = &FileSystem->MftCache[0];
+  for (Index = 0; Index < MFT_CACHE_SIZE; ++Index) {
+    if (FileSystem->MftCache[Index].FileRecord == NULL) {
+      Victim = &FileSystem->MftCache[Index];
+      break;
+    }
+
+    if (FileSystem->MftCache[Index].LastUsed < Victim->LastUsed) {
+      Victim = &FileSystem->MftCache[Index];
+    }
+  }
+
+  if (Victim->FileRecord == NULL) {
+    Victim->FileRecord = AllocatePool (FileSystem->FileRecordSize);
+    if (Victim->FileRecord == NULL) {
+      return;
+    }
+  }
+
+  CopyMem (Victim->FileRecord, Buffer, FileSystem->FileRecordSize);
+  Victim->RecordNumber = RecordNumber;
+  Victim->LastUsed     = ++FileSystem->CacheTick;
+}
+
+STATIC
+EFI_STATUS
+DecodeRunlist (
+  IN  RUNLIST         *Runlist,
+  OUT RUNLIST_EXTENT  **Extents,
+  OUT UINTN           *ExtentCount
+  )
+{
+  EFI_STATUS      Status;
+  RUNLIST         Decoder;
+  RUNLIST_EXTENT  *Buffer;
+  RUNLIST_EXTENT  *NewBuffer;
+  UINTN           Count;
+  UINTN           Capacity;
+  UINT8           *RecordEnd;
+
+  ASSERT (Runlist != NULL);
+  ASSERT (Extents != NULL);
+  ASSERT (ExtentCount != NULL);
+
+  CopyMem (&Decoder, Runlist, sizeof (Decoder));
+  Decoder.Extents = NULL;
+
+  RecordEnd = Runlist->Attr->BaseMftRecord->FileRecord
+              + Runlist->Attr->BaseMftRecord->File->FileSystem->FileRecordSize;
+
+  Count    = 0;
+  Capacity = 16;
+  Buffer   = AllocatePool (Capacity * sizeof (*Buffer));
+  if (Buffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  //
+  // Decode up to the end marker, ReadRunListElement validates every element.
+  //
+  while ((Decoder.NextDataRun < RecordEnd) && (*Decoder.NextDataRun != 0)) {
+    Status = ReadRunListElement (&Decoder);
+    if (EFI_ERROR (Status)) {
+      FreePool (Buffer);
+      return Status;
+    }
+
+    if (Count == Capacity) {
+      NewBuffer = ReallocatePool (
+                    Capacity * sizeof (*Buffer),
+                    2 * Capacity * sizeof (*Buffer),
+                    Buffer
+                    );
+      if (NewBuffer == NULL) {
+        FreePool (Buffer);
+        return EFI_OUT_OF_RESOURCES;
+      }
+
+      Buffer    = NewBuffer;
+      Capacity *= 2;
+    }
+
+    Buffer[Count].Vcn      = Decoder.CurrentVcn;
+    Buffer[Count].NextVcn  = Decoder.NextVcn;
+    Buffer[Count].Lcn      = Decoder.CurrentLcn;
+    Buffer[Count].IsSparse = Decoder.IsSparse;
+    ++Count;
+  }
+
+  *Extents     = Buffer;
+  *ExtentCount = Count;
+
+  return EFI_SUCCESS;
+}
+
+VOID
+RunlistCacheLookup (
+  IN OUT RUNLIST             *Runlist,
+  IN     ATTR_HEADER_NONRES  *NonRes
+  )
+{
+  EFI_STATUS           Status;
+  EFI_FS               *FileSystem;
+  UINT64               RecordNumber;
+  UINTN                Index;
+  RUNLIST_CACHE_ENTRY  *Entry;
+  RUNLIST_CACHE_ENTRY  *Victim;
+  RUNLIST_EXTENT       *Extents;
+  UINTN                ExtentCount;
+
+  ASSERT (Runlist != NULL);
+  ASSERT (NonRes != NULL);
+
+  //
+  // Runlists spread over $ATTRIBUTE_LIST live in several FILE Records
+  // and are resolved lazily by ReadRunListElement, do not cache them.
+  //
+  if ((Runlist->Attr->Flags & NTFS_AF_ALST) != 0) {
+    return;
+  }
+
+  FileSystem   = Runlist->Attr->BaseMftRecord->File->FileSystem;
+  RecordNumber = Runlist->Attr->BaseMftRecord->Inode;
+  Victim       = &FileSystem->RunlistCache[0];
+
+  for (Index = 0; Index < RUNLIST_CACHE_SIZE; ++Index) {
+    Entry = &FileSystem->RunlistCache[Index];
+    if (Entry->Extents == NULL) {
+      Victim = Entry;
+      continue;
+    }
+
+    if (  (Entry->RecordNumber == RecordNumber)
+       && (Entry->Type == NonRes->Type)
+       && (Entry->AttributeId == NonRes->AttributeId)
+       && (Entry->StartingVcn == NonRes->StartingVCN))
+    {
+      Entry->LastUsed      = ++FileSystem->CacheTick;
+      Runlist->Extents     = Entry->Extents;
+      Runlist->ExtentCount = Entry->ExtentCount;
+      return;
+    }
+
+    if ((Victim->Extents != NULL) && (Entry->LastUsed < Victim->LastUsed)) {
+      Victim = Entry;
+    }
+  }
+
+  Status = DecodeRunlist (Runlist, &Extents, &ExtentCount);
+  if (EFI_ERROR (Status)) {
+    //
+    // Let ReadRunListElement report the corruption to the caller.
+    //
+    return;
+  }
+
+  if (Victim->Extents != NULL) {
+    FreePool (Victim->Extents);
+  }
+
+  Victim->RecordNumber = RecordNumber;
+  Victim->Type         = NonRes->Type;
+  Victim->AttributeId  = NonRes->AttributeId;
+  Victim->StartingVcn  = NonRes->StartingVCN;
+  Victim->LastUsed     = ++FileSystem->CacheTick;
+  Victim->ExtentCount  = ExtentCount;
+  Victim->Extents      = Extents;
+
+  Runlist->Extents     = Extents;
+  Runlist->ExtentCount = ExtentCount;
+}
+
+VOID
+RunlistCacheSeek (
+  IN OUT RUNLIST  *Runlist,
+  IN     UINT64   Vcn
+  )
+{
+  UINTN  Low;
+  UINTN  High;
+  UINTN  Middle;
+
+  ASSERT (Runlist != NULL);
+  ASSERT (Runlist->Extents != NULL);
+
+  if ((Runlist->ExtentCount == 0) || (Vcn < Runlist->Extents[0].Vcn)) {
+    return;
+  }
+
+  //
+  // Find the last Extent starting at or before Vcn.
+  //
+  Low  = 0;
+  High = Runlist->ExtentCount - 1U;
+  while (Low < High) {
+    Middle = Low + (High - Low + 1U) / 2U;
+    if (Runlist->Extents[Middle].Vcn <= Vcn) {
+      Low = Middle;
+    } else {
+      High = Middle - 1U;
+    }
+  }
+
+  //
+  // The next ReadRunListElement call will return this Extent.
+  //
+  Runlist->NextExtent = Low;
+  Runlist->NextVcn    = Runlist->Extents[Low].Vcn;
+}
+
+VOID
+FreeCache (
+  IN EFI_FS  *FileSystem
+  )
+{
+  UINTN  Index;
+
+  ASSERT (FileSystem != NULL);
+
+  for (Index = 0; Index < MFT_CACHE_SIZE; ++Index) {
+    if (FileSystem->MftCache[Index].FileRecord != NULL) {
+      FreePool (FileSystem->MftCache[Index].FileRecord);
+      FileSystem->MftCache[Index].FileRecord = NULL;
+    }
+  }
+
+  for (Index = 0; Index < RUNLIST_CACHE_SIZE; ++Index) {
+    if (FileSystem->RunlistCache[Index].Extents != NULL) {
+      FreePool (FileSystem->RunlistCache[Index].Extents);
+      FileSystem->RunlistCache[Index].Extents = NULL;
+    }
+  }
+}
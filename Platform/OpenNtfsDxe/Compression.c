@@ -16,6 +16,10 @@
 extern UINT64  mUnitSize;
 STATIC UINT64  mBufferSize;
 
+/**
+  Reads the rest of the current fragment of a compression unit in one request,
+  so that compressed blocks are decoded from memory.
+**/
 STATIC
 EFI_STATUS
 GetNextCluster (
@@ -24,6 +28,7 @@ GetNextCluster (
 {
   EFI_STATUS  Status;
   UINTN       ClusterSize;
+  UINT64      Count;
 
   ClusterSize = Clusters->FileSystem->ClusterSize;
 
@@ -32,22 +37,28 @@ GetNextCluster (
     return EFI_VOLUME_CORRUPTED;
   }
 
+  Count = 1U;
+  if (Clusters->Elements[Clusters->Head].Vcn > Clusters->CurrentVcn) {
+    Count = MIN (Clusters->Elements[Clusters->Head].Vcn - Clusters->CurrentVcn, mUnitSize);
+  }
+
   Status = DiskRead (
              Clusters->FileSystem,
              (Clusters->Elements[Clusters->Head].Lcn - Clusters->Elements[Clusters->Head].Vcn + Clusters->CurrentVcn) * ClusterSize,
-             ClusterSize,
+             (UINTN)Count * ClusterSize,
              Clusters->Cluster
              );
   if (EFI_ERROR (Status)) {
     return Status;
   }
 
-  ++Clusters->CurrentVcn;
+  Clusters->CurrentVcn += Count;
 
   if (Clusters->CurrentVcn >= Clusters->Elements[Clusters->Head].Vcn) {
     ++Clusters->Head;
   }
 
+  Clusters->ClusterLength = (UINTN)Count * ClusterSize;
   Clusters->ClusterOffset = 0;
 
   return EFI_SUCCESS;
@@ -65,7 +76,7 @@ GetDataRunByte (
   ASSERT (Clusters != NULL);
   ASSERT (Result   != NULL);
 
-  if (Clusters->ClusterOffset >= Clusters->FileSystem->ClusterSize) {
+  if (Clusters->ClusterOffset >= Clusters->ClusterLength) {
     Status = GetNextCluster (Clusters);
     if (EFI_ERROR (Status)) {
       return Status;
@@ -106,6 +117,132 @@ GetTwoDataRunBytes (
   return EFI_SUCCESS;
 }
 
+/**
+  Decodes the tokens of a compressed block, which is entirely in memory.
+  Back-references, which do not overlap the text they produce, and runs
+  of eight plain text tokens are copied at once.
+**/
+STATIC
+EFI_STATUS
+DecompressTokens (
+  IN  CONST UINT8  *Source,
+  IN  UINTN        SourceLength,
+  OUT UINT8        *Dest
+  )
+{
+  CONST UINT8  *SourceEnd;
+  UINTN        ClearTextPointer;
+  UINT8        TagsByte;
+  UINT8        Tokens;
+  UINT16       BackReference;
+  UINT16       Shift;
+  UINT16       Delta;
+  UINT16       Length;
+  UINT16       Index;
+
+  ASSERT (Source != NULL);
+  ASSERT (Dest   != NULL);
+
+  SourceEnd        = Source + SourceLength;
+  ClearTextPointer = 0;
+
+  while (Source < SourceEnd) {
+    if (ClearTextPointer > COMPRESSION_BLOCK) {
+      DEBUG ((DEBUG_INFO, "NTFS: Compression block too large\n"));
+      return EFI_VOLUME_CORRUPTED;
+    }
+
+    TagsByte = *Source++;
+
+    if (  (TagsByte == 0)
+       && ((UINTN)(SourceEnd - Source) >= 8U)
+       && ((ClearTextPointer + 8U) <= COMPRESSION_BLOCK)
+       && (mBufferSize >= 8U))
+    {
+      CopyMem (&Dest[ClearTextPointer], Source, 8U);
+      Source           += 8U;
+      ClearTextPointer += 8U;
+      mBufferSize      -= 8U;
+      continue;
+    }
+
+    for (Tokens = 0; (Tokens < 8U) && (Source < SourceEnd); ++Tokens) {
+      if (ClearTextPointer > COMPRESSION_BLOCK) {
+        DEBUG ((DEBUG_INFO, "NTFS: Compression block too large\n"));
+        return EFI_VOLUME_CORRUPTED;
+      }
+
+      if ((TagsByte & 1U) != 0) {
+        //
+        // Back-reference
+        //
+        if ((UINTN)(SourceEnd - Source) < sizeof (BackReference)) {
+          DEBUG ((DEBUG_INFO, "NTFS: Invalid back-reference.\n"));
+          return EFI_VOLUME_CORRUPTED;
+        }
+
+        BackReference = ReadUnaligned16 ((CONST UINT16 *)Source);
+        Source       += sizeof (BackReference);
+
+        if (ClearTextPointer == 0) {
+          DEBUG ((DEBUG_INFO, "NTFS: Nontext window empty\n"));
+          return EFI_VOLUME_CORRUPTED;
+        }
+
+        //
+        // Same split of the back-reference as in DecompressBlock,
+        // the length field loses a bit each time the window doubles past 16 bytes.
+        //
+        Shift = 0;
+        if ((ClearTextPointer - 1U) >= 0x10U) {
+          Shift = (UINT16)(HighBitSet32 ((UINT32)(ClearTextPointer - 1U)) - 3);
+        }
+
+        Delta  = BackReference >> (12U - Shift);
+        Length = (BackReference & (BLOCK_LENGTH_BITS >> Shift)) + 3U;
+
+        if ((Delta > (ClearTextPointer - 1U)) || (Length >= COMPRESSION_BLOCK)) {
+          DEBUG ((DEBUG_INFO, "NTFS: Invalid back-reference.\n"));
+          return EFI_VOLUME_CORRUPTED;
+        }
+
+        if (mBufferSize < Length) {
+          DEBUG ((DEBUG_INFO, "NTFS: (DecompressTokens #1) Buffer overflow.\n"));
+          return EFI_VOLUME_CORRUPTED;
+        }
+
+        if (Delta == 0) {
+          SetMem (&Dest[ClearTextPointer], Length, Dest[ClearTextPointer - 1U]);
+        } else if (Length <= (Delta + 1U)) {
+          CopyMem (&Dest[ClearTextPointer], &Dest[ClearTextPointer - Delta - 1U], Length);
+        } else {
+          for (Index = 0; Index < Length; ++Index) {
+            Dest[ClearTextPointer + Index] = Dest[ClearTextPointer + Index - Delta - 1U];
+          }
+        }
+
+        ClearTextPointer += Length;
+        mBufferSize      -= Length;
+      } else {
+        //
+        // Plain text
+        //
+        if (mBufferSize == 0) {
+          DEBUG ((DEBUG_INFO, "NTFS: (DecompressTokens #2) Buffer overflow.\n"));
+          return EFI_VOLUME_CORRUPTED;
+        }
+
+        Dest[ClearTextPointer++] = *Source++;
+        --mBufferSize;
+      }
+
+      TagsByte >>= 1U;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
 /**
   * The basic idea is that substrings of the block which have been seen before
     are compressed by referencing the string rather than mentioning it again.
@@ -190,6 +327,26 @@ DecompressBlock (
 
   if (Dest != NULL) {
     if ((BlockParameters & IS_COMPRESSED_BLOCK) != 0) {
+      if (Clusters->ClusterOffset >= Clusters->ClusterLength) {
+        Status = GetNextCluster (Clusters);
+        if (EFI_ERROR (Status)) {
+          return Status;
+        }
+      }
+
+      if ((Clusters->ClusterLength - Clusters->ClusterOffset) >= BlockLength) {
+        Status = DecompressTokens (
+                   &Clusters->Cluster[Clusters->ClusterOffset],
+                   BlockLength,
+                   Dest
+                   );
+        Clusters->ClusterOffset += BlockLength;
+        return Status;
+      }
+
+      //
+      // The block crosses a fragment of the compression unit, decode it bytewise.
+      //
       ClearTextPointer = 0;
       Tokens           = 0;
       TagsByte         = 0;
@@ -288,7 +445,7 @@ DecompressBlock (
   }
 
   while (BlockLength > 0) {
-    SpareBytes = Clusters->FileSystem->ClusterSize - Clusters->ClusterOffset;
+    SpareBytes = Clusters->ClusterLength - Clusters->ClusterOffset;
     if (SpareBytes > BlockLength) {
       SpareBytes = BlockLength;
     }
@@ -410,7 +567,8 @@ ReadCompressedBlock (
 
       Runlist->Unit.Head          = Runlist->Unit.Tail = 0;
       Runlist->Unit.CurrentVcn    = Runlist->TargetVcn;
-      Runlist->Unit.ClusterOffset = ClusterSize;
+      Runlist->Unit.ClusterLength = 0;
+      Runlist->Unit.ClusterOffset = 0;
       if (Runlist->TargetVcn >= Runlist->NextVcn) {
         Status = ReadRunListElement (Runlist);
         if (EFI_ERROR (Status)) {
@@ -603,7 +761,7 @@ Decompress (
   }
 
   Runlist->Unit.Head    = Runlist->Unit.Tail = 0;
-  Runlist->Unit.Cluster = AllocateZeroPool (ClusterSize);
+  Runlist->Unit.Cluster = AllocateZeroPool ((UINTN)mUnitSize * ClusterSize);
   if (Runlist->Unit.Cluster == NULL) {
     FreePool (Runlist->Unit.ClearTextBlock);
     return EFI_OUT_OF_RESOURCES;
@@ -11,32 +11,6 @@
 
 UINT64  mUnitSize;
 
-STATIC
-UINT64
-GetLcn (
-  IN OUT RUNLIST  *Runlist,
-  IN     UINT64   Vcn
-  )
-{
-  EFI_STATUS  Status;
-  UINT64      Delta;
-
-  ASSERT (Runlist != NULL);
-
-  if (Vcn >= Runlist->NextVcn) {
-    Status = ReadRunListElement (Runlist);
-    if (EFI_ERROR (Status)) {
-      return (UINT64)(-1);
-    }
-
-    return Runlist->CurrentLcn;
-  }
-
-  Delta = Vcn - Runlist->CurrentVcn;
-
-  return Runlist->IsSparse ? 0 : (Runlist->CurrentLcn + Delta);
-}
-
 STATIC
 EFI_STATUS
 ReadClusters (
@@ -49,9 +23,10 @@ ReadClusters (
   EFI_STATUS  Status;
   UINT64      Index;
   UINT64      ClustersTotal;
+  UINT64      RunEnd;
   UINT64      Cluster;
   UINT64      OffsetInsideCluster;
-  UINTN       Size;
+  UINT64      Size;
   UINTN       ClusterSize;
 
   ASSERT (Runlist != NULL);
@@ -59,53 +34,46 @@ ReadClusters (
 
   ClusterSize         = Runlist->Unit.FileSystem->ClusterSize;
   OffsetInsideCluster = Offset & (ClusterSize - 1U);
-  Size                = ClusterSize;
   ClustersTotal       = DivU64x64Remainder (Length + Offset + ClusterSize - 1U, ClusterSize, NULL);
 
-  for (Index = Runlist->TargetVcn; Index < ClustersTotal; ++Index) {
-    Cluster = GetLcn (Runlist, Index);
-    if (Cluster == (UINT64)(-1)) {
-      return EFI_DEVICE_ERROR;
-    }
-
-    Cluster *= ClusterSize;
-
-    if (Index == (ClustersTotal - 1U)) {
-      Size = (UINTN)((Length + Offset) & (ClusterSize - 1U));
-
-      if (Size == 0) {
-        Size = ClusterSize;
-      }
-
-      if (Index != Runlist->TargetVcn) {
-        OffsetInsideCluster = 0;
+  Index = Runlist->TargetVcn;
+  while ((Index < ClustersTotal) && (Length > 0)) {
+    while (Index >= Runlist->NextVcn) {
+      Status = ReadRunListElement (Runlist);
+      if (EFI_ERROR (Status)) {
+        return EFI_DEVICE_ERROR;
       }
     }
 
-    if (Index == Runlist->TargetVcn) {
-      Size -= (UINTN)OffsetInsideCluster;
+    //
+    // Clusters of a single run are contiguous on disk, read them at once.
+    //
+    RunEnd = MIN (Runlist->NextVcn, ClustersTotal);
+    Size   = MultU64x64 (RunEnd - Index, ClusterSize) - OffsetInsideCluster;
+    if (Size > Length) {
+      Size = Length;
     }
 
-    if ((Index != Runlist->TargetVcn) && (Index != (ClustersTotal - 1U))) {
-      Size                = ClusterSize;
-      OffsetInsideCluster = 0;
-    }
+    if (Runlist->IsSparse) {
+      SetMem (Dest, (UINTN)Size, 0);
+    } else {
+      Cluster = MultU64x64 (Runlist->CurrentLcn + (Index - Runlist->CurrentVcn), ClusterSize);
 
-    if (Cluster != 0) {
       Status = DiskRead (
                  Runlist->Unit.FileSystem,
                  Cluster + OffsetInsideCluster,
-                 Size,
+                 (UINTN)Size,
                  Dest
                  );
       if (EFI_ERROR (Status)) {
         return Status;
       }
-    } else {
-      SetMem (Dest, Size, 0);
     }
 
-    Dest += Size;
+    Dest               += Size;
+    Length             -= (UINTN)Size;
+    Index               = RunEnd;
+    OffsetInsideCluster = 0;
   }
 
   return EFI_SUCCESS;
@@ -157,6 +125,10 @@ ReadMftRecord (
   ASSERT (File != NULL);
   ASSERT (Buffer != NULL);
 
+  if (MftCacheLookup (File->FileSystem, RecordNumber, Buffer)) {
+    return EFI_SUCCESS;
+  }
+
   FileRecordSize = File->FileSystem->FileRecordSize;
 
   Status = ReadAttr (
@@ -171,12 +143,19 @@ ReadMftRecord (
     return Status;
   }
 
-  return Fixup (
-           Buffer,
-           FileRecordSize,
-           SIGNATURE_32 ('F', 'I', 'L', 'E'),
-           File->FileSystem->SectorSize
-           );
+  Status = Fixup (
+             Buffer,
+             FileRecordSize,
+             SIGNATURE_32 ('F', 'I', 'L', 'E'),
+             File->FileSystem->SectorSize
+             );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  MftCacheInsert (File->FileSystem, RecordNumber, Buffer);
+
+  return EFI_SUCCESS;
 }
 
 EFI_STATUS
@@ -353,6 +332,15 @@ ReadData (
     return EFI_VOLUME_CORRUPTED;
   }
 
+  //
+  // Skip straight to the Data Run containing the start of the compression unit,
+  // the compressed path rewinds TargetVcn to it.
+  //
+  RunlistCacheLookup (Runlist, NonRes);
+  if (Runlist->Extents != NULL) {
+    RunlistCacheSeek (Runlist, Runlist->TargetVcn & ~0xFULL);
+  }
+
   if (  ((NonRes->Flags & FLAG_COMPRESSED) != 0)
      && ((Attr->Flags & NTFS_AF_GPOS) == 0)
      && (NonRes->Type == AT_DATA))
@@ -479,6 +467,21 @@ ReadRunListElement (
 
   ASSERT (Runlist != NULL);
 
+  if (Runlist->Extents != NULL) {
+    if (Runlist->NextExtent >= Runlist->ExtentCount) {
+      DEBUG ((DEBUG_INFO, "NTFS: Run list overflown\n"));
+      return EFI_VOLUME_CORRUPTED;
+    }
+
+    Runlist->CurrentVcn = Runlist->Extents[Runlist->NextExtent].Vcn;
+    Runlist->NextVcn    = Runlist->Extents[Runlist->NextExtent].NextVcn;
+    Runlist->CurrentLcn = Runlist->Extents[Runlist->NextExtent].Lcn;
+    Runlist->IsSparse   = Runlist->Extents[Runlist->NextExtent].IsSparse;
+    ++Runlist->NextExtent;
+
+    return EFI_SUCCESS;
+  }
+
   Run            = Runlist->NextDataRun;
   FileRecordSize = Runlist->Attr->BaseMftRecord->File->FileSystem->FileRecordSize;
   BufferSize     = FileRecordSize - (Run - Runlist->Attr->BaseMftRecord->FileRecord);
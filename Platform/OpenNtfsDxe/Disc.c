@@ -174,6 +174,7 @@ NtfsMount (
   RootFile->FileSystem    = FileSystem;
   RootFile->RootFile.File = RootFile;
   RootFile->MftFile.File  = RootFile;
+  RootFile->MftFile.Inode = MFT_FILE;
 
   RootFile->MftFile.FileRecord = AllocateZeroPool (FileSystem->FileRecordSize);
   if (RootFile->MftFile.FileRecord == NULL) {
@@ -736,6 +737,7 @@ InitFile (
   ASSERT (File != NULL);
 
   File->InodeRead = TRUE;
+  File->Inode     = RecordNumber;
 
   File->FileRecord = AllocateZeroPool (File->File->FileSystem->FileRecordSize);
   if (File->FileRecord == NULL) {
@@ -20,6 +20,8 @@
 #define MAX_FILE_SIZE           (MAX_UINT32 & ~7ULL)
 #define S_FILENAME              0x3
 #define S_SYMLINK               0xC
+#define MFT_CACHE_SIZE          16
+#define RUNLIST_CACHE_SIZE      16
 
 /**
   ************
@@ -636,6 +638,38 @@ typedef struct _EFI_NTFS_FILE {
   EFI_FS               *FileSystem;
 } EFI_NTFS_FILE;
 
+///
+/// Decoded Data Run: VCN range and its starting LCN.
+///
+typedef struct {
+  UINT64     Vcn;
+  UINT64     NextVcn;
+  UINT64     Lcn;
+  BOOLEAN    IsSparse;
+} RUNLIST_EXTENT;
+
+///
+/// Fixed-up FILE Record, FileRecord is NULL for unused entries.
+///
+typedef struct {
+  UINT64    RecordNumber;
+  UINT64    LastUsed;
+  UINT8     *FileRecord;
+} MFT_CACHE_ENTRY;
+
+///
+/// Decoded Runlist of a non-resident Attribute, Extents is NULL for unused entries.
+///
+typedef struct {
+  UINT64            RecordNumber;
+  UINT32            Type;
+  UINT16            AttributeId;
+  UINT64            StartingVcn;
+  UINT64            LastUsed;
+  UINTN             ExtentCount;
+  RUNLIST_EXTENT    *Extents;
+} RUNLIST_CACHE_ENTRY;
+
 typedef struct _EFI_FS {
   EFI_SIMPLE_FILE_SYSTEM_PROTOCOL    FileIoInterface;
   EFI_FILE_PROTOCOL                  EfiFile;
@@ -649,6 +683,9 @@ typedef struct _EFI_FS {
   UINTN                              IndexRecordSize;
   UINTN                              SectorSize;
   UINTN                              ClusterSize;
+  UINT64                             CacheTick;
+  MFT_CACHE_ENTRY                    MftCache[MFT_CACHE_SIZE];
+  RUNLIST_CACHE_ENTRY                RunlistCache[RUNLIST_CACHE_SIZE];
 } EFI_FS;
 
 typedef struct {
@@ -663,20 +700,24 @@ typedef struct {
   UNIT_ELEMENT    Elements[16];
   UINT64          CurrentVcn;
   UINT8           *Cluster;
+  UINTN           ClusterLength;
   UINTN           ClusterOffset;
   UINT64          SavedPosition;
   UINT8           *ClearTextBlock;
 } COMPRESSED;
 
 typedef struct {
-  BOOLEAN       IsSparse;
-  UINT64        TargetVcn;
-  UINT64        CurrentVcn;
-  UINT64        CurrentLcn;
-  UINT64        NextVcn;
-  UINT8         *NextDataRun;
-  NTFS_ATTR     *Attr;
-  COMPRESSED    Unit;
+  BOOLEAN           IsSparse;
+  UINT64            TargetVcn;
+  UINT64            CurrentVcn;
+  UINT64            CurrentLcn;
+  UINT64            NextVcn;
+  UINT8             *NextDataRun;
+  NTFS_ATTR         *Attr;
+  COMPRESSED        Unit;
+  RUNLIST_EXTENT    *Extents;
+  UINTN             ExtentCount;
+  UINTN             NextExtent;
 } RUNLIST;
 
 #endif // DRIVER_H
@@ -109,6 +109,37 @@ ReadRunListElement (
   IN OUT RUNLIST  *Runlist
   );
 
+BOOLEAN
+MftCacheLookup (
+  IN  EFI_FS  *FileSystem,
+  IN  UINT64  RecordNumber,
+  OUT UINT8   *Buffer
+  );
+
+VOID
+MftCacheInsert (
+  IN EFI_FS       *FileSystem,
+  IN UINT64       RecordNumber,
+  IN CONST UINT8  *Buffer
+  );
+
+VOID
+RunlistCacheLookup (
+  IN OUT RUNLIST             *Runlist,
+  IN     ATTR_HEADER_NONRES  *NonRes
+  );
+
+VOID
+RunlistCacheSeek (
+  IN OUT RUNLIST  *Runlist,
+  IN     UINT64   Vcn
+  );
+
+VOID
+FreeCache (
+  IN EFI_FS  *FileSystem
+  );
+
 EFI_STATUS
 NtfsDir (
   IN  EFI_FS         *FileSystem,
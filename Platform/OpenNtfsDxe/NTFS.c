@@ -178,6 +178,7 @@ NTFSSupported (
          Controller
          );
 
+  FreeCache (Instance);
   FreePool (Instance);
 
   return Status;
@@ -282,6 +283,7 @@ NTFSStart (
   Status = NtfsMount (Instance);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_INFO, "NTFS: Could not mount file system.\n"));
+    FreeCache (Instance);
     FreePool (Instance);
     return Status;
   }
@@ -306,6 +308,7 @@ NTFSStart (
     FreePool (Instance->RootIndex->FileRecord);
     FreePool (Instance->MftStart->FileRecord);
     FreePool (Instance->RootIndex->File);
+    FreeCache (Instance);
 
     FreePool (Instance);
     return EFI_UNSUPPORTED;
@@ -350,6 +353,7 @@ NTFSStop (
   FreePool (Instance->RootIndex->FileRecord);
   FreePool (Instance->MftStart->FileRecord);
   FreePool (Instance->RootIndex->File);
+  FreeCache (Instance);
 
   Status = gBS->UninstallMultipleProtocolInterfaces (
                   Controller,
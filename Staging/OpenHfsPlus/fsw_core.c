@@ -41,9 +41,16 @@
 // functions
 
 static void fsw_blockcache_free(struct fsw_volume *vol);
+static fsw_u32 fsw_blockcache_find(struct fsw_volume *vol, fsw_u32 phys_bno);
+static void fsw_blockcache_link(struct fsw_volume *vol, fsw_u32 i, fsw_u32 phys_bno, fsw_u32 cache_level);
+static void fsw_blockcache_unlink(struct fsw_volume *vol, fsw_u32 i);
+static fsw_status_t fsw_blockcache_slot(struct fsw_volume *vol, fsw_u32 *index_out);
 
 #define MAX_CACHE_LEVEL (5)
 
+#define FSW_BCACHE_NONE (~0U)
+#define FSW_BCACHE_HASH(bno) (((bno) ^ ((bno) >> 8)) & (FSW_BCACHE_HASH_SIZE - 1))
+
 
 /**
  * Mount a volume with a given file system driver. This function is called by the
@@ -179,8 +186,7 @@ void fsw_set_blocksize(struct fsw_volume *vol, fsw_u32 phys_blocksize, fsw_u32 l
 fsw_status_t fsw_block_get(struct VOLSTRUCTNAME *vol, fsw_u32 phys_bno, fsw_u32 cache_level, void **buffer_out)
 {
     fsw_status_t    status;
-    fsw_u32         i, discard_level, new_bcache_size;
-    struct fsw_blockcache *new_bcache;
+    fsw_u32         i;
     
     // TODO: allow the host driver to do its own caching; just call through if
     //  the appropriate function pointers are set
@@ -189,38 +195,218 @@ fsw_status_t fsw_block_get(struct VOLSTRUCTNAME *vol, fsw_u32 phys_bno, fsw_u32
         cache_level = MAX_CACHE_LEVEL;
     
     // check block cache
-    for (i = 0; i < vol->bcache_size; i++) {
-        if (vol->bcache[i].phys_bno == phys_bno) {
-            // cache hit!
-            if (vol->bcache[i].cache_level < cache_level)
-                vol->bcache[i].cache_level = cache_level;  // promote the entry
-            vol->bcache[i].refcount++;
-            *buffer_out = vol->bcache[i].data;
-            return FSW_SUCCESS;
-        }
+    i = fsw_blockcache_find(vol, phys_bno);
+    if (i != FSW_BCACHE_NONE) {
+        // cache hit!
+        if (vol->bcache[i].cache_level < cache_level)
+            vol->bcache[i].cache_level = cache_level;  // promote the entry
+        vol->bcache[i].refcount++;
+        vol->bcache[i].referenced = 1;
+        vol->bcache_hits++;
+        *buffer_out = vol->bcache[i].data;
+        return FSW_SUCCESS;
     }
+    vol->bcache_misses++;
     
     // find a free entry in the cache table
-    for (i = 0; i < vol->bcache_size; i++) {
-        if (vol->bcache[i].phys_bno == FSW_INVALID_BNO)
+    status = fsw_blockcache_slot(vol, &i);
+    if (status)
+        return status;
+    
+    // read the data
+    status = vol->host_table->read_block(vol, phys_bno, vol->bcache[i].data);
+    if (status)
+        return status;
+    
+    fsw_blockcache_link(vol, i, phys_bno, cache_level);
+    vol->bcache[i].refcount = 1;
+    *buffer_out = vol->bcache[i].data;
+    return FSW_SUCCESS;
+}
+
+/**
+ * Releases a disk block. This function must be called to release disk blocks returned
+ * from fsw_block_get.
+ */
+
+void fsw_block_release(struct VOLSTRUCTNAME *vol, fsw_u32 phys_bno, void *buffer)
+{
+    fsw_u32 i;
+    
+    // TODO: allow the host driver to do its own caching; just call through if
+    //  the appropriate function pointers are set
+    
+    // update block cache
+    i = fsw_blockcache_find(vol, phys_bno);
+    if (i != FSW_BCACHE_NONE && vol->bcache[i].refcount > 0)
+        vol->bcache[i].refcount--;
+}
+
+/**
+ * Read consecutive disk blocks into the block cache with a single request, if the host
+ * driver supports it. This is a hint used for metadata, which is likely to be accessed
+ * next (e.g. adjacent B-tree nodes). Blocks read ahead start at the lowest cache level
+ * and are promoted once actually requested. Errors are ignored, fsw_block_get will
+ * report them.
+ */
+
+void fsw_block_readahead(struct VOLSTRUCTNAME *vol, fsw_u32 phys_bno, fsw_u32 count)
+{
+    fsw_status_t    status;
+    fsw_u32         i, n;
+    fsw_u8          *buffer;
+    
+    if (vol->host_table->read_blocks == NULL)
+        return;
+    if (count > FSW_BCACHE_READAHEAD)
+        count = FSW_BCACHE_READAHEAD;
+    if (count < 2 || phys_bno + count < phys_bno)
+        return;
+    
+    // nothing to do when the first block is cached already
+    if (fsw_blockcache_find(vol, phys_bno) != FSW_BCACHE_NONE)
+        return;
+    
+    status = fsw_alloc(count * vol->phys_blocksize, &buffer);
+    if (status)
+        return;
+    
+    status = vol->host_table->read_blocks(vol, phys_bno, count, buffer);
+    if (status == FSW_SUCCESS) {
+        for (n = 0; n < count; n++) {
+            if (fsw_blockcache_find(vol, phys_bno + n) != FSW_BCACHE_NONE)
+                continue;
+            if (fsw_blockcache_slot(vol, &i))
+                break;
+            fsw_memcpy(vol->bcache[i].data, buffer + n * vol->phys_blocksize, vol->phys_blocksize);
+            fsw_blockcache_link(vol, i, phys_bno + n, 0);
+        }
+    }
+    
+    fsw_free(buffer);
+}
+
+/**
+ * Find the block cache entry of a physical block through the hash buckets.
+ * Returns FSW_BCACHE_NONE if the block is not cached.
+ */
+
+static fsw_u32 fsw_blockcache_find(struct fsw_volume *vol, fsw_u32 phys_bno)
+{
+    fsw_u32 i;
+    
+    if (vol->bcache_hash == NULL)
+        return FSW_BCACHE_NONE;
+    
+    for (i = vol->bcache_hash[FSW_BCACHE_HASH(phys_bno)]; i != FSW_BCACHE_NONE; i = vol->bcache[i].hash_next) {
+        if (vol->bcache[i].phys_bno == phys_bno)
+            return i;
+    }
+    return FSW_BCACHE_NONE;
+}
+
+/**
+ * Insert a filled block cache entry into its hash bucket.
+ */
+
+static void fsw_blockcache_link(struct fsw_volume *vol, fsw_u32 i, fsw_u32 phys_bno, fsw_u32 cache_level)
+{
+    fsw_u32 *bucket;
+    
+    bucket = &vol->bcache_hash[FSW_BCACHE_HASH(phys_bno)];
+    vol->bcache[i].phys_bno = phys_bno;
+    vol->bcache[i].cache_level = cache_level;
+    vol->bcache[i].referenced = 1;
+    vol->bcache[i].hash_next = *bucket;
+    *bucket = i;
+}
+
+/**
+ * Remove a block cache entry from its hash bucket and mark it free.
+ */
+
+static void fsw_blockcache_unlink(struct fsw_volume *vol, fsw_u32 i)
+{
+    fsw_u32 *link;
+    
+    link = &vol->bcache_hash[FSW_BCACHE_HASH(vol->bcache[i].phys_bno)];
+    while (*link != FSW_BCACHE_NONE) {
+        if (*link == i) {
+            *link = vol->bcache[i].hash_next;
             break;
+        }
+        link = &vol->bcache[*link].hash_next;
     }
-    if (i >= vol->bcache_size) {
-        for (discard_level = 0; discard_level <= MAX_CACHE_LEVEL; discard_level++) {
-            for (i = 0; i < vol->bcache_size; i++) {
-                if (vol->bcache[i].refcount == 0 && vol->bcache[i].cache_level <= discard_level)
+    vol->bcache[i].phys_bno = FSW_INVALID_BNO;
+    vol->bcache[i].hash_next = FSW_BCACHE_NONE;
+}
+
+/**
+ * Get a free block cache entry with an allocated data buffer. While the cache is within
+ * its memory budget, new entries are used. Afterwards an unreferenced entry is evicted
+ * by a clock sweep preferring the lowest cache level, with recently accessed entries
+ * getting a second chance. The cache only grows past the budget when all blocks are in use.
+ */
+
+static fsw_status_t fsw_blockcache_slot(struct fsw_volume *vol, fsw_u32 *index_out)
+{
+    fsw_status_t    status;
+    fsw_u32         i, j, n, max_bcache_size, new_bcache_size;
+    struct fsw_blockcache *new_bcache;
+    
+    if (vol->bcache_hash == NULL) {
+        status = fsw_alloc(FSW_BCACHE_HASH_SIZE * sizeof(fsw_u32), &vol->bcache_hash);
+        if (status)
+            return status;
+        for (i = 0; i < FSW_BCACHE_HASH_SIZE; i++)
+            vol->bcache_hash[i] = FSW_BCACHE_NONE;
+    }
+    
+    max_bcache_size = FSW_BCACHE_MAX_BYTES / vol->phys_blocksize;
+    if (max_bcache_size < 16)
+        max_bcache_size = 16;
+    
+    i = FSW_BCACHE_NONE;
+    if (vol->bcache_used < vol->bcache_size) {
+        i = vol->bcache_used++;
+    } else if (vol->bcache_size >= max_bcache_size) {
+        // one clock rotation, recently accessed entries get a second chance
+        for (n = 0; n < vol->bcache_size; n++) {
+            if (vol->bcache_clock >= vol->bcache_size)
+                vol->bcache_clock = 0;
+            j = vol->bcache_clock++;
+            if (vol->bcache[j].refcount > 0)
+                continue;
+            if (vol->bcache[j].referenced) {
+                vol->bcache[j].referenced = 0;
+                continue;
+            }
+            if (i == FSW_BCACHE_NONE || vol->bcache[j].cache_level < vol->bcache[i].cache_level) {
+                i = j;
+                if (vol->bcache[i].cache_level == 0)
                     break;
             }
-            if (i < vol->bcache_size)
-                break;
         }
+        // all unused entries were accessed recently, take the lowest level one
+        if (i == FSW_BCACHE_NONE) {
+            for (j = 0; j < vol->bcache_size; j++) {
+                if (vol->bcache[j].refcount == 0 &&
+                    (i == FSW_BCACHE_NONE || vol->bcache[j].cache_level < vol->bcache[i].cache_level))
+                    i = j;
+            }
+        }
+        if (i != FSW_BCACHE_NONE && vol->bcache[i].phys_bno != FSW_INVALID_BNO)
+            fsw_blockcache_unlink(vol, i);
     }
-    if (i >= vol->bcache_size) {
+    
+    if (i == FSW_BCACHE_NONE) {
         // enlarge / create the cache
         if (vol->bcache_size < 16)
             new_bcache_size = 16;
         else
             new_bcache_size = vol->bcache_size << 1;
+        if (vol->bcache_size < max_bcache_size && new_bcache_size > max_bcache_size)
+            new_bcache_size = max_bcache_size;
         status = fsw_alloc(new_bcache_size * sizeof(struct fsw_blockcache), &new_bcache);
         if (status)
             return status;
@@ -230,54 +416,31 @@ fsw_status_t fsw_block_get(struct VOLSTRUCTNAME *vol, fsw_u32 phys_bno, fsw_u32
             new_bcache[i].refcount = 0;
             new_bcache[i].cache_level = 0;
             new_bcache[i].phys_bno = FSW_INVALID_BNO;
+            new_bcache[i].hash_next = FSW_BCACHE_NONE;
+            new_bcache[i].referenced = 0;
             new_bcache[i].data = NULL;
         }
-        i = vol->bcache_size;
         
         // switch caches
         if (vol->bcache != NULL)
             fsw_free(vol->bcache);
         vol->bcache = new_bcache;
         vol->bcache_size = new_bcache_size;
+        i = vol->bcache_used++;
     }
-    vol->bcache[i].phys_bno = FSW_INVALID_BNO;
     
-    // read the data
+    vol->bcache[i].cache_level = 0;
+    vol->bcache[i].referenced = 0;
     if (vol->bcache[i].data == NULL) {
         status = fsw_alloc(vol->phys_blocksize, &vol->bcache[i].data);
         if (status)
             return status;
     }
-    status = vol->host_table->read_block(vol, phys_bno, vol->bcache[i].data);
-    if (status)
-        return status;
     
-    vol->bcache[i].phys_bno = phys_bno;
-    vol->bcache[i].cache_level = cache_level;
-    vol->bcache[i].refcount = 1;
-    *buffer_out = vol->bcache[i].data;
+    *index_out = i;
     return FSW_SUCCESS;
 }
 
-/**
- * Releases a disk block. This function must be called to release disk blocks returned
- * from fsw_block_get.
- */
-
-void fsw_block_release(struct VOLSTRUCTNAME *vol, fsw_u32 phys_bno, void *buffer)
-{
-    fsw_u32 i;
-    
-    // TODO: allow the host driver to do its own caching; just call through if
-    //  the appropriate function pointers are set
-    
-    // update block cache
-    for (i = 0; i < vol->bcache_size; i++) {
-        if (vol->bcache[i].phys_bno == phys_bno && vol->bcache[i].refcount > 0)
-            vol->bcache[i].refcount--;
-    }
-}
-
 /**
  * Release the block cache. Called internally when changing block sizes and when
  * unmounting the volume. It frees all data occupied by the generic block cache.
@@ -295,7 +458,13 @@ static void fsw_blockcache_free(struct fsw_volume *vol)
         fsw_free(vol->bcache);
         vol->bcache = NULL;
     }
+    if (vol->bcache_hash != NULL) {
+        fsw_free(vol->bcache_hash);
+        vol->bcache_hash = NULL;
+    }
     vol->bcache_size = 0;
+    vol->bcache_used = 0;
+    vol->bcache_clock = 0;
 }
 
 /**
@@ -911,6 +1080,12 @@ fsw_status_t fsw_shandle_read(struct fsw_shandle *shand, fsw_u32 *buffer_size_in
             if (copylen > buflen)
                 copylen = buflen;
             
+            // read ahead the following metadata blocks of this extent (e.g. adjacent B-tree nodes)
+            if (cache_level > 0)
+                fsw_block_readahead(vol, phys_bno,
+                                    shand->extent.log_count * (vol->log_blocksize / vol->phys_blocksize)
+                                    - pos_in_extent / vol->phys_blocksize);
+            
             // get one physical block
             status = fsw_block_get(vol, phys_bno, cache_level, (void **)&block_buffer);
             if (status)
@@ -55,6 +55,13 @@
 /** Indicates that the block cache entry is empty. */
 #define FSW_INVALID_BNO (~0U)
 
+/** Number of hash buckets of the block cache, must be a power of 2. */
+#define FSW_BCACHE_HASH_SIZE (256)
+/** Memory budget of the block cache data buffers in bytes. */
+#define FSW_BCACHE_MAX_BYTES (4 * 1024 * 1024)
+/** Maximum number of physical blocks read ahead for metadata. */
+#define FSW_BCACHE_READAHEAD (8)
+
 
 //
 // Byte-swapping macros
@@ -211,6 +218,8 @@ struct fsw_blockcache {
     fsw_u32     refcount;           //!< Reference count
     fsw_u32     cache_level;        //!< Level of importance of this block
     fsw_u32     phys_bno;           //!< Physical block number
+    fsw_u32     hash_next;          //!< Index of the next entry in the same hash bucket
+    fsw_u32     referenced;         //!< Set on access, cleared by the eviction clock
     void        *data;              //!< Block data buffer
 };
 
@@ -229,6 +238,11 @@ struct fsw_volume {
     
     struct fsw_blockcache *bcache;  //!< Array of block cache entries
     fsw_u32     bcache_size;        //!< Number of entries in the block cache array
+    fsw_u32     bcache_used;        //!< Number of entries ever filled in the block cache array
+    fsw_u32     bcache_clock;       //!< Eviction clock hand
+    fsw_u32     *bcache_hash;       //!< Hash buckets with indices of the first entries
+    fsw_u32     bcache_hits;        //!< Number of block cache hits
+    fsw_u32     bcache_misses;      //!< Number of block cache misses
     
     void        *host_data;         //!< Hook for a host-specific data structure
     struct fsw_host_table *host_table;      //!< Dispatch table for host-specific functions
@@ -350,6 +364,7 @@ struct fsw_host_table
                                      fsw_u32 old_phys_blocksize, fsw_u32 old_log_blocksize,
                                      fsw_u32 new_phys_blocksize, fsw_u32 new_log_blocksize);
     fsw_status_t (*read_block)(struct fsw_volume *vol, fsw_u32 phys_bno, void *buffer);
+    fsw_status_t (*read_blocks)(struct fsw_volume *vol, fsw_u32 phys_bno, fsw_u32 count, void *buffer);  //!< Optional, for readahead
 };
 
 /**
@@ -398,6 +413,7 @@ fsw_status_t fsw_volume_stat(struct fsw_volume *vol, struct fsw_volume_stat *sb)
 void         fsw_set_blocksize(struct VOLSTRUCTNAME *vol, fsw_u32 phys_blocksize, fsw_u32 log_blocksize);
 fsw_status_t fsw_block_get(struct VOLSTRUCTNAME *vol, fsw_u32 phys_bno, fsw_u32 cache_level, void **buffer_out);
 void         fsw_block_release(struct VOLSTRUCTNAME *vol, fsw_u32 phys_bno, void *buffer);
+void         fsw_block_readahead(struct VOLSTRUCTNAME *vol, fsw_u32 phys_bno, fsw_u32 count);
 
 /*@}*/
 
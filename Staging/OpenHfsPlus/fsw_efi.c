@@ -76,6 +76,7 @@ void fsw_efi_change_blocksize(struct fsw_volume *vol,
                               fsw_u32 old_phys_blocksize, fsw_u32 old_log_blocksize,
                               fsw_u32 new_phys_blocksize, fsw_u32 new_log_blocksize);
 fsw_status_t fsw_efi_read_block(struct fsw_volume *vol, fsw_u32 phys_bno, void *buffer);
+fsw_status_t fsw_efi_read_blocks(struct fsw_volume *vol, fsw_u32 phys_bno, fsw_u32 count, void *buffer);
 
 EFI_STATUS fsw_efi_map_status(fsw_status_t fsw_status, FSW_VOLUME_DATA *Volume);
 
@@ -147,7 +148,8 @@ struct fsw_host_table   fsw_efi_host_table = {
     FSW_STRING_TYPE_UTF16,
     
     fsw_efi_change_blocksize,
-    fsw_efi_read_block
+    fsw_efi_read_block,
+    fsw_efi_read_blocks
 };
 
 extern struct fsw_fstype_table   FSW_FSTYPE_TABLE_NAME(FSTYPE);
@@ -449,6 +451,29 @@ fsw_status_t fsw_efi_read_block(struct fsw_volume *vol, fsw_u32 phys_bno, void *
     return FSW_SUCCESS;
 }
 
+/**
+ * FSW interface function to read several consecutive data blocks at once. This function
+ * is called by the FSW core for readahead into the block cache.
+ */
+
+fsw_status_t fsw_efi_read_blocks(struct fsw_volume *vol, fsw_u32 phys_bno, fsw_u32 count, void *buffer)
+{
+    EFI_STATUS          Status;
+    FSW_VOLUME_DATA     *Volume = (FSW_VOLUME_DATA *)vol->host_data;
+    
+    FSW_MSG_DEBUGV((FSW_MSGSTR("fsw_efi_read_blocks: %d %d  (%d)\n"), phys_bno, count, vol->phys_blocksize));
+    
+    // read from disk
+    Status = Volume->DiskIo->ReadDisk(Volume->DiskIo, Volume->MediaId,
+                                      (UINT64)phys_bno * vol->phys_blocksize,
+                                      (UINTN)count * vol->phys_blocksize,
+                                      buffer);
+    Volume->LastIOStatus = Status;
+    if (EFI_ERROR(Status))
+        return FSW_IO_ERROR;
+    return FSW_SUCCESS;
+}
+
 /**
  * Map FSW status codes to EFI status codes. The FSW_IO_ERROR code is only produced
  * by fsw_efi_read_block, so we map it back to the EFI status code remembered from
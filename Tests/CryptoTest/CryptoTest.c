@@ -26,11 +26,14 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 
 #include <Library/OcMiscLib.h>
 #include <Library/PrintLib.h>
+#include <Library/TimerLib.h>
 #include <Library/UefiDriverEntryPoint.h>
 #include <Protocol/SimpleTextInEx.h>
 
 #include "CryptoSamples.h"
 
+#define AES_THROUGHPUT_DATA_LEN  SIZE_1MB
+
 EFI_STATUS
 EFIAPI
 TestRsa2048Sha256Verify (
@@ -210,6 +213,107 @@ TestAesCbc (
   return Status;
 }
 
+STATIC
+VOID
+PrintAesThroughput (
+  IN CONST CHAR16  *Name,
+  IN UINT64        PerfStart
+  )
+{
+  UINT64  Time;
+
+  Time = GetTimeInNanoSecond (GetPerformanceCounter () - PerfStart);
+  if (Time == 0) {
+    Print (L"%s: too fast to measure\n", Name);
+    return;
+  }
+
+  Print (
+    L"%s: %Lu KB/s\n",
+    Name,
+    DivU64x64Remainder (MultU64x32 (AES_THROUGHPUT_DATA_LEN / SIZE_1KB, 1000000000U), Time, NULL)
+    );
+}
+
+EFI_STATUS
+EFIAPI
+TestAesThroughput (
+  VOID
+  )
+{
+  AES_CONTEXT  Ctx;
+  UINT8        *Data;
+  UINT8        *Original;
+  UINT64       PerfStart;
+  UINTN        Index;
+  BOOLEAN      AesTestPassed;
+
+  Data     = AllocatePool (AES_THROUGHPUT_DATA_LEN);
+  Original = AllocatePool (AES_THROUGHPUT_DATA_LEN);
+  if ((Data == NULL) || (Original == NULL)) {
+    if (Data != NULL) {
+      FreePool (Data);
+    }
+
+    if (Original != NULL) {
+      FreePool (Original);
+    }
+
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  for (Index = 0; Index < AES_THROUGHPUT_DATA_LEN; ++Index) {
+    Original[Index] = (UINT8)(Index * 7 + (Index >> 8));
+  }
+
+  CopyMem (Data, Original, AES_THROUGHPUT_DATA_LEN);
+  AesTestPassed = TRUE;
+
+  //
+  // CBC round trip
+  //
+  AesInitCtxIv (&Ctx, AesCbcSample.Key, AesCbcSample.IV);
+  PerfStart = GetPerformanceCounter ();
+  AesCbcEncryptBuffer (&Ctx, Data, AES_THROUGHPUT_DATA_LEN);
+  PrintAesThroughput (L"AES-128 CBC encryption", PerfStart);
+
+  AesInitCtxIv (&Ctx, AesCbcSample.Key, AesCbcSample.IV);
+  PerfStart = GetPerformanceCounter ();
+  AesCbcDecryptBuffer (&Ctx, Data, AES_THROUGHPUT_DATA_LEN);
+  PrintAesThroughput (L"AES-128 CBC decryption", PerfStart);
+
+  if (CompareMem (Data, Original, AES_THROUGHPUT_DATA_LEN) != 0) {
+    Print (L"AES-128 CBC round trip failed\n");
+    AesTestPassed = FALSE;
+  }
+
+  //
+  // CTR round trip, with a length that ends in a partial block
+  //
+  AesInitCtxIv (&Ctx, AesCtrSample.Key, AesCtrSample.IV);
+  PerfStart = GetPerformanceCounter ();
+  AesCtrXcryptBuffer (&Ctx, Data, AES_THROUGHPUT_DATA_LEN - 1);
+  PrintAesThroughput (L"AES-128 CTR", PerfStart);
+
+  AesInitCtxIv (&Ctx, AesCtrSample.Key, AesCtrSample.IV);
+  AesCtrXcryptBuffer (&Ctx, Data, AES_THROUGHPUT_DATA_LEN - 1);
+
+  if (CompareMem (Data, Original, AES_THROUGHPUT_DATA_LEN) != 0) {
+    Print (L"AES-128 CTR round trip failed\n");
+    AesTestPassed = FALSE;
+  }
+
+  ZeroMem (&Ctx, sizeof (Ctx));
+  FreePool (Data);
+  FreePool (Original);
+
+  if (!AesTestPassed) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  return EFI_SUCCESS;
+}
+
 EFI_STATUS
 EFIAPI
 TestChaCha (
@@ -285,15 +389,16 @@ TestHash (
   VOID
   )
 {
-  EFI_STATUS  Status         = EFI_INVALID_PARAMETER;
-  UINTN       Index          = 0;
-  UINTN       Index2         = 0;
-  BOOLEAN     HashTestPassed = TRUE;
-  UINT8       Md5Hash[MD5_DIGEST_SIZE];
-  UINT8       Sha1Hash[SHA1_DIGEST_SIZE];
-  UINT8       Sha256Hash[SHA256_DIGEST_SIZE];
-  UINT8       Sha512Hash[SHA512_DIGEST_SIZE];
-  UINT8       Sha384Hash[SHA384_DIGEST_SIZE];
+  EFI_STATUS            Status         = EFI_INVALID_PARAMETER;
+  UINTN                 Index          = 0;
+  UINTN                 Index2         = 0;
+  BOOLEAN               HashTestPassed = TRUE;
+  UINT8                 Md5Hash[MD5_DIGEST_SIZE];
+  UINT8                 Sha1Hash[SHA1_DIGEST_SIZE];
+  UINT8                 Sha256Hash[SHA256_DIGEST_SIZE];
+  UINT8                 Sha512Hash[SHA512_DIGEST_SIZE];
+  UINT8                 Sha384Hash[SHA384_DIGEST_SIZE];
+  SHA256_MULTI_MESSAGE  Sha256Messages[HASH_SAMPLES_NUM];
 
   //
   // Iterate through hash samples
@@ -383,6 +488,23 @@ TestHash (
     ZeroMem (Sha384Hash, SHA384_DIGEST_SIZE);
   }
 
+  //
+  // Hash all samples at once to cover the multi-buffer path.
+  //
+  for (Index = 0; Index < HASH_SAMPLES_NUM; Index++) {
+    Sha256Messages[Index].Data   = HashSamples[Index].PlainText;
+    Sha256Messages[Index].Length = HashSamples[Index].PlainTextLen;
+  }
+
+  Sha256Multi (Sha256Messages, HASH_SAMPLES_NUM);
+
+  for (Index = 0; Index < HASH_SAMPLES_NUM; Index++) {
+    if (CompareMem (Sha256Messages[Index].Hash, HashSamples[Index].Sha256Hash, SHA256_DIGEST_SIZE) != 0) {
+      Print (L"Sha256Multi hash test №%lu failed\n", Index);
+      HashTestPassed = FALSE;
+    }
+  }
+
   if (HashTestPassed) {
     Status = EFI_SUCCESS;
   } else {
@@ -446,6 +568,17 @@ UefiDriverMain (
     Print (L"AES-128-CTR passed!\n");
   }
 
+  //
+  // Test AES throughput
+  //
+  Status = TestAesThroughput ();
+  if (EFI_ERROR (Status)) {
+    Print (L"AES throughput failed!\n");
+    Failure = TRUE;
+  } else {
+    Print (L"AES throughput passed!\n");
+  }
+
   Status = TestChaCha ();
   if (EFI_ERROR (Status)) {
     Print (L"ChaCha failed!\n");
@@ -527,6 +660,19 @@ UefiAppMain (
 
   WaitForKeyPress (L"Press any key...");
 
+  //
+  // Test AES throughput
+  //
+  Status = TestAesThroughput ();
+  if (EFI_ERROR (Status)) {
+    Print (L"AES throughput failed!\n");
+    Failure = TRUE;
+  } else {
+    Print (L"AES throughput passed!\n");
+  }
+
+  WaitForKeyPress (L"Press any key...");
+
   //
   // Test ChaCha
   //
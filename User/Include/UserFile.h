@@ -56,6 +56,34 @@ UserReadFile (
   OUT UINT32       *Size
   );
 
+/**
+  Map a file on disk into memory for reading without copying it.
+  Falls back to UserReadFile on platforms without mmap.
+
+  @param[in]  FileName  ASCII string containing the name of the file to be opened.
+  @param[out] Size      Size of the file.
+
+  @return  A pointer to read-only buffer containing the content of FileName.
+           Must be released with UserUnmapFile.
+**/
+CONST UINT8 *
+UserMapFile (
+  IN  CONST CHAR8  *FileName,
+  OUT UINT32       *Size
+  );
+
+/**
+  Release the file mapping returned by UserMapFile.
+
+  @param[in]  Data  Mapped file contents.
+  @param[in]  Size  Size of the mapped file.
+**/
+VOID
+UserUnmapFile (
+  IN  CONST UINT8  *Data,
+  IN  UINT32       Size
+  );
+
 /**
   Write the buffer to the file.
 
@@ -0,0 +1,31 @@
+/** @file
+  Copyright (c) 2023, Acidanthera. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-3-Clause
+**/
+
+#ifndef OC_USER_MISC_H
+#define OC_USER_MISC_H
+
+/**
+  Get monotonic time for benchmarking.
+
+  @return  Current monotonic time in microseconds.
+**/
+UINT64
+UserGetTimeUs (
+  VOID
+  );
+
+/**
+  Advance a linear congruential generator for reproducible test data.
+
+  @param[in,out]  State  Generator state, updated on return.
+
+  @return  Next pseudo random value.
+**/
+UINT32
+UserPseudoRandom (
+  IN OUT UINT32  *State
+  );
+
+#endif // OC_USER_MISC_H
@@ -7,6 +7,13 @@
 #include <Library/DebugLib.h>
 #include <Library/MemoryAllocationLib.h>
 
+#ifndef _WIN32
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
 #ifdef COVERAGE_TEST
   #if defined (__clang__)
 void
@@ -111,6 +118,67 @@ UserReadFile (
   return Buffer;
 }
 
+CONST UINT8 *
+UserMapFile (
+  IN  CONST CHAR8  *FileName,
+  OUT UINT32       *Size
+  )
+{
+ #ifdef _WIN32
+  return UserReadFile (FileName, Size);
+ #else // !_WIN32
+  int          FileDesc;
+  struct stat  FileStat;
+  VOID         *Buffer;
+
+  ASSERT (FileName != NULL);
+  ASSERT (Size != NULL);
+
+  FileDesc = open (FileName, O_RDONLY);
+  if (FileDesc < 0) {
+    return NULL;
+  }
+
+  if (  (fstat (FileDesc, &FileStat) != 0)
+     || !S_ISREG (FileStat.st_mode)
+     || (FileStat.st_size <= 0)
+     || ((UINT64)FileStat.st_size > MAX_UINT32))
+  {
+    close (FileDesc);
+    return NULL;
+  }
+
+  Buffer = mmap (NULL, (size_t)FileStat.st_size, PROT_READ, MAP_PRIVATE, FileDesc, 0);
+  //
+  // The mapping stays valid after closing the descriptor.
+  //
+  close (FileDesc);
+
+  if (Buffer == MAP_FAILED) {
+    return NULL;
+  }
+
+  *Size = (UINT32)FileStat.st_size;
+
+  return Buffer;
+ #endif // _WIN32
+}
+
+VOID
+UserUnmapFile (
+  IN  CONST UINT8  *Data,
+  IN  UINT32       Size
+  )
+{
+  ASSERT (Data != NULL);
+
+ #ifdef _WIN32
+  FreePool ((VOID *)Data);
+ #else // !_WIN32
+  munmap ((VOID *)Data, Size);
+ #endif // _WIN32
+}
+
 VOID
 UserWriteFile (
   IN  CONST CHAR8  *FileName,
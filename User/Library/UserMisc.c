@@ -8,6 +8,10 @@
 #include <Library/UefiApplicationEntryPoint.h>
 #include <Library/DebugLib.h>
 
+#include <UserMisc.h>
+
+#include <time.h>
+
 VOID
 EFIAPI
 CpuBreakpoint (
@@ -703,3 +707,23 @@ GetSerialRegisterBase (
 {
   return 0;
 }
+
+UINT64
+UserGetTimeUs (
+  VOID
+  )
+{
+  struct timespec  Time;
+
+  clock_gettime (CLOCK_MONOTONIC, &Time);
+  return (UINT64)Time.tv_sec * 1000000ULL + (UINT64)Time.tv_nsec / 1000ULL;
+}
+
+UINT32
+UserPseudoRandom (
+  IN OUT UINT32  *State
+  )
+{
+  *State = *State * 1103515245U + 12345U;
+  return *State;
+}
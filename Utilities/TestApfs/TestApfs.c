@@ -0,0 +1,249 @@
+/** @file
+  Copyright (c) 2023, Acidanthera. All rights reserved.
+  SPDX-License-Identifier: BSD-3-Clause
+**/
+
+#include <OcApfsInternal.h>
+
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+
+#include <UserFile.h>
+#include <UserMisc.h>
+
+//
+// Objects cover the whole block except the checksum field.
+//
+#define APFS_OBJECT_SIZE(BlockSize)  ((BlockSize) - sizeof (UINT64))
+
+/**
+  Plain Fletcher-64 as found in the APFS reference, used to verify
+  the optimised implementation.
+**/
+STATIC
+UINT64
+ReferenceFletcher64 (
+  IN CONST UINT32  *Data,
+  IN UINTN         DataSize
+  )
+{
+  UINT64  Sum1;
+  UINT64  Sum2;
+  UINT64  Check1;
+  UINT64  Check2;
+  UINTN   Index;
+
+  Sum1 = 0;
+  Sum2 = 0;
+
+  for (Index = 0; Index < DataSize / sizeof (UINT32); ++Index) {
+    Sum1 = (Sum1 + Data[Index]) % MAX_UINT32;
+    Sum2 = (Sum2 + Sum1) % MAX_UINT32;
+  }
+
+  Check1 = MAX_UINT32 - ((Sum1 + Sum2) % MAX_UINT32);
+  Check2 = MAX_UINT32 - ((Sum1 + Check1) % MAX_UINT32);
+
+  return (Check2 << 32U) | Check1;
+}
+
+STATIC
+BOOLEAN
+CheckObject (
+  IN CONST UINT32  *Data,
+  IN UINTN         DataSize
+  )
+{
+  UINT64  Expected;
+  UINT64  Actual;
+
+  Expected = ReferenceFletcher64 (Data, DataSize);
+  Actual   = InternalApfsFletcher64 (Data, DataSize);
+  if (Expected != Actual) {
+    DEBUG ((DEBUG_ERROR, "Checksum mismatch for %u bytes - %016Lx vs %016Lx\n", (UINT32)DataSize, Actual, Expected));
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+/**
+  Compares the optimised checksum against the reference for every
+  supported block size with random, zero and all-ones contents.
+**/
+STATIC
+INT32
+SelfTest (
+  VOID
+  )
+{
+  UINT32  *Block;
+  UINT32  BlockSize;
+  UINT32  Index;
+  UINT32  Round;
+  UINT32  State;
+  UINTN   Passed;
+
+  Block = AllocatePool (APFS_NX_MAXIMUM_BLOCK_SIZE);
+  if (Block == NULL) {
+    return -1;
+  }
+
+  Passed = 0;
+  State  = 0x41504653U;
+
+  for (BlockSize = APFS_NX_MINIMUM_BLOCK_SIZE; BlockSize <= APFS_NX_MAXIMUM_BLOCK_SIZE; BlockSize *= 2) {
+    SetMem (Block, BlockSize, 0);
+    if (!CheckObject (Block, APFS_OBJECT_SIZE (BlockSize))) {
+      break;
+    }
+
+    ++Passed;
+
+    //
+    // All-ones exercises the largest intermediate sums.
+    //
+    SetMem (Block, BlockSize, 0xFF);
+    if (!CheckObject (Block, APFS_OBJECT_SIZE (BlockSize))) {
+      break;
+    }
+
+    ++Passed;
+
+    for (Round = 0; Round < 64; ++Round) {
+      for (Index = 0; Index < BlockSize / sizeof (UINT32); ++Index) {
+        Block[Index] = UserPseudoRandom (&State);
+      }
+
+      if (!CheckObject (Block, APFS_OBJECT_SIZE (BlockSize))) {
+        break;
+      }
+
+      ++Passed;
+    }
+
+    if (Round < 64) {
+      break;
+    }
+  }
+
+  FreePool (Block);
+
+  DEBUG ((DEBUG_ERROR, "Fletcher-64 %a after %u checks\n", BlockSize > APFS_NX_MAXIMUM_BLOCK_SIZE ? "passed" : "FAILED", (UINT32)Passed));
+
+  return BlockSize > APFS_NX_MAXIMUM_BLOCK_SIZE ? 0 : -1;
+}
+
+STATIC
+INT32
+Benchmark (
+  IN UINT32  Iterations
+  )
+{
+  UINT32  *Block;
+  UINT32  Index;
+  UINT32  State;
+  UINT64  Checksum;
+  UINT64  StartTime;
+  UINT64  Reference;
+  UINT64  Optimised;
+
+  Block = AllocatePool (APFS_NX_MINIMUM_BLOCK_SIZE);
+  if (Block == NULL) {
+    return -1;
+  }
+
+  State = 0x41504653U;
+  for (Index = 0; Index < APFS_NX_MINIMUM_BLOCK_SIZE / sizeof (UINT32); ++Index) {
+    Block[Index] = UserPseudoRandom (&State);
+  }
+
+  Checksum  = 0;
+  StartTime = UserGetTimeUs ();
+  for (Index = 0; Index < Iterations; ++Index) {
+    Checksum += ReferenceFletcher64 (Block, APFS_OBJECT_SIZE (APFS_NX_MINIMUM_BLOCK_SIZE));
+    Block[0] += (UINT32)Checksum;
+  }
+
+  Reference = UserGetTimeUs () - StartTime;
+
+  StartTime = UserGetTimeUs ();
+  for (Index = 0; Index < Iterations; ++Index) {
+    Checksum += InternalApfsFletcher64 (Block, APFS_OBJECT_SIZE (APFS_NX_MINIMUM_BLOCK_SIZE));
+    Block[0] += (UINT32)Checksum;
+  }
+
+  Optimised = UserGetTimeUs () - StartTime;
+
+  DEBUG ((
+    DEBUG_ERROR,
+    "%u blocks of %u bytes: reference %Lu us, optimised %Lu us (%Lx)\n",
+    Iterations,
+    APFS_NX_MINIMUM_BLOCK_SIZE,
+    Reference,
+    Optimised,
+    Checksum
+    ));
+
+  FreePool (Block);
+  return 0;
+}
+
+INT32
+LLVMFuzzerTestOneInput (
+  CONST UINT8  *Data,
+  UINTN        Size
+  )
+{
+  UINT32  *Block;
+  UINTN   DataSize;
+
+  //
+  // Pad or truncate the input to the closest valid object size.
+  //
+  DataSize = MIN (Size, APFS_OBJECT_SIZE (APFS_NX_MAXIMUM_BLOCK_SIZE)) & ~(sizeof (UINT32) - 1);
+  DataSize = MAX (DataSize, APFS_OBJECT_SIZE (APFS_NX_MINIMUM_BLOCK_SIZE));
+
+  Block = AllocateZeroPool (DataSize);
+  if (Block == NULL) {
+    return 0;
+  }
+
+  CopyMem (Block, Data, MIN (Size, DataSize));
+
+  if (!CheckObject (Block, DataSize)) {
+    abort ();
+  }
+
+  FreePool (Block);
+  return 0;
+}
+
+int
+ENTRY_POINT (
+  int   argc,
+  char  **argv
+  )
+{
+  uint32_t  f;
+  uint8_t   *b;
+
+  if ((argc > 1) && (AsciiStrCmp (argv[1], "-b") == 0)) {
+    return Benchmark ((argc > 2) ? (UINT32)AsciiStrDecimalToUintn (argv[2]) : 100000);
+  }
+
+  if (argc > 1) {
+    if ((b = UserReadFile (argv[1], &f)) == NULL) {
+      DEBUG ((DEBUG_ERROR, "Read fail\n"));
+      return -1;
+    }
+
+    LLVMFuzzerTestOneInput (b, f);
+    FreePool (b);
+    return 0;
+  }
+
+  return SelfTest ();
+}
@@ -30,3 +30,15 @@ OcReadFileSize (
   ASSERT (FALSE);
   return EFI_UNSUPPORTED;
 }
+
+EFI_STATUS
+OcFileExistsCached (
+  IN       EFI_HANDLE         Device    OPTIONAL,
+  IN CONST CHAR16             *Prefix   OPTIONAL,
+  IN CONST EFI_FILE_PROTOCOL  *Directory,
+  IN CONST CHAR16             *FileName
+  )
+{
+  ASSERT (FALSE);
+  return EFI_UNSUPPORTED;
+}
@@ -16,3 +16,15 @@ OcGetFileSize (
   ASSERT (FALSE);
   return EFI_UNSUPPORTED;
 }
+
+EFI_STATUS
+OcGetFileDataToPages (
+  IN  EFI_FILE_PROTOCOL  *File,
+  IN  UINT64             Position,
+  IN  UINTN              Size,
+  OUT UINT8              *Buffer
+  )
+{
+  ASSERT (FALSE);
+  return EFI_UNSUPPORTED;
+}
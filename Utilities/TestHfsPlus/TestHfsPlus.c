@@ -0,0 +1,386 @@
+/** @file
+  Copyright (c) 2023, Acidanthera. All rights reserved.
+  SPDX-License-Identifier: BSD-3-Clause
+**/
+
+#include <fsw_efi.h>
+
+#include <UserFile.h>
+#include <UserGlobalVar.h>
+#include <UserMisc.h>
+
+//
+// Limits protecting the fuzzer from looping over crafted catalogs.
+//
+#define FUZZ_MAX_ENTRIES    1024
+#define FUZZ_MAX_FILE_SIZE  SIZE_1MB
+#define WALK_MAX_DEPTH      32
+#define WALK_READ_SIZE      SIZE_64KB
+#define WALK_INFO_SIZE      (SIZE_OF_EFI_FILE_INFO + 256 * sizeof (CHAR16))
+
+typedef struct {
+  UINTN     Entries;
+  UINTN     MaxEntries;
+  UINT64    MaxFileSize;
+  UINTN     Directories;
+  UINTN     Files;
+  UINT64    Bytes;
+  UINT8     *Buffer;
+} WALK_CONTEXT;
+
+extern struct fsw_host_table    fsw_efi_host_table;
+extern struct fsw_fstype_table  FSW_FSTYPE_TABLE_NAME (FSTYPE);
+
+EFI_STATUS
+EFIAPI
+fsw_efi_FileSystem_OpenVolume (
+  IN  EFI_FILE_IO_INTERFACE  *This,
+  OUT EFI_FILE               **Root
+  );
+
+EFI_STATUS
+fsw_efi_map_status (
+  IN fsw_status_t     fsw_status,
+  IN FSW_VOLUME_DATA  *Volume
+  );
+
+STATIC CONST UINT8  *mImage;
+STATIC UINTN        mImageSize;
+STATIC UINT64       mReadCount;
+STATIC UINT64       mReadBytes;
+
+EFI_STATUS
+EFIAPI
+ImageReadDisk (
+  IN  EFI_DISK_IO_PROTOCOL  *This,
+  IN  UINT32                MediaId,
+  IN  UINT64                Offset,
+  IN  UINTN                 BufferSize,
+  OUT VOID                  *Buffer
+  )
+{
+  if (Buffer == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if ((Offset > mImageSize) || ((mImageSize - Offset) < BufferSize)) {
+    return EFI_DEVICE_ERROR;
+  }
+
+  CopyMem (Buffer, &mImage[Offset], BufferSize);
+
+  ++mReadCount;
+  mReadBytes += BufferSize;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Mounts the image at mImage the way fsw_efi_DriverBinding_Start does,
+  with a stand-in Disk I/O protocol.
+**/
+STATIC
+EFI_STATUS
+MountImage (
+  OUT FSW_VOLUME_DATA  *Volume,
+  OUT EFI_DISK_IO      *DiskIo
+  )
+{
+  ZeroMem (DiskIo, sizeof (*DiskIo));
+  DiskIo->ReadDisk = ImageReadDisk;
+
+  ZeroMem (Volume, sizeof (*Volume));
+  Volume->Signature    = FSW_VOLUME_DATA_SIGNATURE;
+  Volume->DiskIo       = DiskIo;
+  Volume->LastIOStatus = EFI_SUCCESS;
+
+  Volume->FileSystem.Revision   = EFI_FILE_IO_INTERFACE_REVISION;
+  Volume->FileSystem.OpenVolume = fsw_efi_FileSystem_OpenVolume;
+
+  return fsw_efi_map_status (
+           fsw_mount (Volume, &fsw_efi_host_table, &FSW_FSTYPE_TABLE_NAME (FSTYPE), &Volume->vol),
+           Volume
+           );
+}
+
+STATIC
+VOID
+UnmountImage (
+  IN FSW_VOLUME_DATA  *Volume
+  )
+{
+  if (Volume->vol != NULL) {
+    fsw_unmount (Volume->vol);
+    Volume->vol = NULL;
+  }
+}
+
+STATIC
+EFI_STATUS
+ReadWholeFile (
+  IN OUT WALK_CONTEXT  *Context,
+  IN     EFI_FILE      *File
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       ReadSize;
+  UINT64      FileBytes;
+
+  FileBytes = 0;
+  do {
+    ReadSize = WALK_READ_SIZE;
+    Status   = File->Read (File, &ReadSize, Context->Buffer);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
+    FileBytes += ReadSize;
+  } while (ReadSize == WALK_READ_SIZE && FileBytes < Context->MaxFileSize);
+
+  Context->Bytes += FileBytes;
+  ++Context->Files;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Recursively enumerates a directory, opening every entry and reading
+  every regular file to the end.
+**/
+STATIC
+EFI_STATUS
+WalkDirectory (
+  IN OUT WALK_CONTEXT  *Context,
+  IN     EFI_FILE      *Directory,
+  IN     UINTN         Depth
+  )
+{
+  EFI_STATUS     Status;
+  EFI_FILE       *Child;
+  EFI_FILE_INFO  *Info;
+  UINTN          InfoSize;
+
+  if (Depth > WALK_MAX_DEPTH) {
+    return EFI_SUCCESS;
+  }
+
+  ++Context->Directories;
+
+  Info = AllocatePool (WALK_INFO_SIZE);
+  if (Info == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = EFI_SUCCESS;
+  while (Context->Entries < Context->MaxEntries) {
+    InfoSize = WALK_INFO_SIZE;
+    Status   = Directory->Read (Directory, &InfoSize, Info);
+    if (EFI_ERROR (Status) || (InfoSize == 0)) {
+      break;
+    }
+
+    ++Context->Entries;
+
+    if (  (StrCmp (Info->FileName, L".") == 0)
+       || (StrCmp (Info->FileName, L"..") == 0))
+    {
+      continue;
+    }
+
+    //
+    // Entries may be dangling links, which is not a walk failure.
+    //
+    if (EFI_ERROR (Directory->Open (Directory, &Child, Info->FileName, EFI_FILE_MODE_READ, 0))) {
+      continue;
+    }
+
+    if ((Info->Attribute & EFI_FILE_DIRECTORY) != 0) {
+      Status = WalkDirectory (Context, Child, Depth + 1);
+    } else {
+      Status = ReadWholeFile (Context, Child);
+    }
+
+    Child->Close (Child);
+
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+  }
+
+  FreePool (Info);
+  return Status;
+}
+
+STATIC
+EFI_STATUS
+WalkVolume (
+  IN OUT WALK_CONTEXT     *Context,
+  IN     FSW_VOLUME_DATA  *Volume
+  )
+{
+  EFI_STATUS  Status;
+  EFI_FILE    *Root;
+  UINTN       InfoSize;
+  VOID        *Info;
+
+  Status = Volume->FileSystem.OpenVolume (&Volume->FileSystem, &Root);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  InfoSize = 0;
+  Status   = Root->GetInfo (Root, &gEfiFileSystemInfoGuid, &InfoSize, NULL);
+  if (Status == EFI_BUFFER_TOO_SMALL) {
+    Info = AllocatePool (InfoSize);
+    if (Info != NULL) {
+      Root->GetInfo (Root, &gEfiFileSystemInfoGuid, &InfoSize, Info);
+      FreePool (Info);
+    }
+  }
+
+  Status = WalkDirectory (Context, Root, 0);
+
+  Root->Close (Root);
+  return Status;
+}
+
+INT32
+LLVMFuzzerTestOneInput (
+  CONST UINT8  *FuzzData,
+  UINTN        FuzzSize
+  )
+{
+  EFI_STATUS       Status;
+  FSW_VOLUME_DATA  Volume;
+  EFI_DISK_IO      DiskIo;
+  WALK_CONTEXT     Context;
+
+  mImage     = FuzzData;
+  mImageSize = FuzzSize;
+
+  Status = MountImage (&Volume, &DiskIo);
+  if (!EFI_ERROR (Status)) {
+    ZeroMem (&Context, sizeof (Context));
+    Context.MaxEntries  = FUZZ_MAX_ENTRIES;
+    Context.MaxFileSize = FUZZ_MAX_FILE_SIZE;
+    Context.Buffer      = AllocatePool (WALK_READ_SIZE);
+    if (Context.Buffer != NULL) {
+      WalkVolume (&Context, &Volume);
+      FreePool (Context.Buffer);
+    }
+  }
+
+  UnmountImage (&Volume);
+
+  return 0;
+}
+
+/**
+  Walks the whole catalog of an HFS+ image repeatedly, reading every file,
+  and reports the throughput together with the block cache statistics.
+  The volume stays mounted between the iterations, so every pass after
+  the first one shows the warm cache behaviour.
+**/
+STATIC
+INT32
+BenchmarkImage (
+  IN CONST CHAR8  *ImageName,
+  IN UINT32       Iterations
+  )
+{
+  EFI_STATUS       Status;
+  FSW_VOLUME_DATA  Volume;
+  EFI_DISK_IO      DiskIo;
+  WALK_CONTEXT     Context;
+  UINT32           ImageSize;
+  UINT32           Index;
+  UINT64           StartTime;
+  UINT64           Elapsed;
+
+  mImage = UserMapFile (ImageName, &ImageSize);
+  if (mImage == NULL) {
+    DEBUG ((DEBUG_ERROR, "Read fail\n"));
+    return -1;
+  }
+
+  mImageSize = ImageSize;
+
+  Status = MountImage (&Volume, &DiskIo);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Mount fail - %r\n", Status));
+    UnmountImage (&Volume);
+    UserUnmapFile (mImage, mImageSize);
+    return -1;
+  }
+
+  ZeroMem (&Context, sizeof (Context));
+  Context.MaxEntries  = MAX_UINTN;
+  Context.MaxFileSize = MAX_UINT64;
+  Context.Buffer      = AllocatePool (WALK_READ_SIZE);
+  Status              = (Context.Buffer != NULL) ? EFI_SUCCESS : EFI_OUT_OF_RESOURCES;
+
+  mReadCount = 0;
+  mReadBytes = 0;
+  StartTime  = UserGetTimeUs ();
+  for (Index = 0; (Index < Iterations) && !EFI_ERROR (Status); ++Index) {
+    Status = WalkVolume (&Context, &Volume);
+  }
+
+  Elapsed = UserGetTimeUs () - StartTime;
+
+  if (!EFI_ERROR (Status)) {
+    DEBUG ((
+      DEBUG_ERROR,
+      "Walked %u directories and %u files (%Lu bytes) in %Lu us (%Lu KB/s)\n",
+      (UINT32)Context.Directories,
+      (UINT32)Context.Files,
+      Context.Bytes,
+      Elapsed,
+      (Elapsed != 0) ? DivU64x64Remainder (Context.Bytes * 1000000ULL / 1024ULL, Elapsed, NULL) : 0
+      ));
+    DEBUG ((
+      DEBUG_ERROR,
+      "Disk reads %Lu (%Lu bytes), block cache %u/%u entries, %u hits, %u misses\n",
+      mReadCount,
+      mReadBytes,
+      Volume.vol->bcache_used,
+      Volume.vol->bcache_size,
+      Volume.vol->bcache_hits,
+      Volume.vol->bcache_misses
+      ));
+  } else {
+    DEBUG ((DEBUG_ERROR, "Walk fail - %r\n", Status));
+  }
+
+  if (Context.Buffer != NULL) {
+    FreePool (Context.Buffer);
+  }
+
+  UnmountImage (&Volume);
+  UserUnmapFile (mImage, mImageSize);
+
+  return EFI_ERROR (Status) ? -1 : 0;
+}
+
+int
+ENTRY_POINT (
+  int   argc,
+  char  **argv
+  )
+{
+  uint32_t  f;
+  uint8_t   *b;
+
+  if ((argc > 2) && (AsciiStrCmp (argv[1], "-b") == 0)) {
+    return BenchmarkImage (argv[2], (argc > 3) ? (UINT32)AsciiStrDecimalToUintn (argv[3]) : 10);
+  }
+
+  if ((b = UserReadFile ((argc > 1) ? argv[1] : "in.bin", &f)) == NULL) {
+    DEBUG ((DEBUG_ERROR, "Read fail\n"));
+    return -1;
+  }
+
+  LLVMFuzzerTestOneInput (b, f);
+  FreePool (b);
+  return 0;
+}
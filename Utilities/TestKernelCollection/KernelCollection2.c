@@ -27,6 +27,7 @@
 #include <stdlib.h>
 
 #include <File.h>
+#include <UserMisc.h>
 
 /*
  for fuzzing (TODO):
@@ -123,6 +124,7 @@ int main(int argc, char** argv) {
   uint8_t *Prelinked;
   UINT32 AllocSize;
   PRELINKED_CONTEXT Context;
+  UINT64 StartTime;
 
   PcdGet32 (PcdFixedDebugPrintErrorLevel) |= DEBUG_INFO;
   PcdGet32 (PcdDebugPrintErrorLevel)      |= DEBUG_INFO;
@@ -196,6 +198,11 @@ int main(int argc, char** argv) {
       return -1;
     }
 
+    //
+    // Measure injection time including fixup chain indexing.
+    //
+    StartTime = UserGetTimeUs ();
+
     Status = PrelinkedInjectKext (
       &Context,
       "/Library/Extensions/Lilu.kext",
@@ -227,6 +234,8 @@ int main(int argc, char** argv) {
       DEBUG ((DEBUG_WARN, "Prelink inject complete error %r\n", Status));
     }
 
+    DEBUG ((DEBUG_INFO, "Injection took %Lu us\n", UserGetTimeUs () - StartTime));
+
     writeFile("out.bin", Prelinked, Context.PrelinkedSize);
     if (!EFI_ERROR (Status)) {
       printf("All good\n");
@@ -589,7 +589,11 @@ WrapMain (
   CONST CHAR8  *FileName;
 
   FileName = argc > 1 ? argv[1] : "/System/Library/PrelinkedKernels/prelinkedkernel";
-  if ((mPrelinked = UserReadFile (FileName, &mPrelinkedSize)) == NULL) {
+  //
+  // The kernel is only read through OcGetFileData until ReadAppleKernel
+  // makes a writable copy, so map it instead of reading.
+  //
+  if ((mPrelinked = (UINT8 *)UserMapFile (FileName, &mPrelinkedSize)) == NULL) {
     DEBUG ((DEBUG_ERROR, "Read fail %a\n", FileName));
     return -1;
   }
@@ -673,7 +677,7 @@ WrapMain (
                          );
 
   if (!EFI_ERROR (Status)) {
-    FreePool (mPrelinked);
+    UserUnmapFile (mPrelinked, mPrelinkedSize);
     mPrelinked     = NewPrelinked;
     mPrelinkedSize = NewPrelinkedSize;
     DEBUG ((DEBUG_WARN, "[OK] Sha384 is %02X%02X%02X%02X\n", Sha384[0], Sha384[1], Sha384[2], Sha384[3]));
@@ -8,11 +8,15 @@
 
 #include <UserFile.h>
 #include <UserGlobalVar.h>
+#include <UserMisc.h>
 
 UINTN        mFuzzOffset;
 UINTN        mFuzzSize;
 CONST UINT8  *mFuzzPointer;
 
+STATIC CONST UINT8  *mImage;
+STATIC UINT32       mImageSize;
+
 EFI_STATUS
 EFIAPI
 FuzzReadDisk (
@@ -67,6 +71,7 @@ FreeAll (
       FreePool (Instance->RootIndex->File);
     }
 
+    FreeCache (Instance);
     FreePool (Instance);
   }
 }
@@ -237,6 +242,156 @@ LLVMFuzzerTestOneInput (
   return 0;
 }
 
+EFI_STATUS
+EFIAPI
+ImageReadDisk (
+  IN  EFI_DISK_IO_PROTOCOL  *This,
+  IN  UINT32                MediaId,
+  IN  UINT64                Offset,
+  IN  UINTN                 BufferSize,
+  OUT VOID                  *Buffer
+  )
+{
+  if (Buffer == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if ((Offset > mImageSize) || ((mImageSize - Offset) < BufferSize)) {
+    return EFI_DEVICE_ERROR;
+  }
+
+  CopyMem (Buffer, &mImage[Offset], BufferSize);
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Reads a file from an NTFS image repeatedly, e.g. a compressed file
+  from an image prepared with ntfs-3g, and reports the read throughput.
+**/
+STATIC
+INT32
+BenchmarkFile (
+  IN CONST CHAR8  *ImageName,
+  IN CONST CHAR8  *Path,
+  IN UINT32       Iterations
+  )
+{
+  EFI_STATUS             Status;
+  EFI_FS                 *Instance;
+  EFI_DISK_IO_PROTOCOL   DiskIo;
+  EFI_BLOCK_IO_PROTOCOL  BlockIo;
+  EFI_BLOCK_IO_MEDIA     Media;
+  EFI_FILE_PROTOCOL      *NewHandle;
+  CHAR16                 FileName[MAX_PATH];
+  UINTN                  Index;
+  UINT64                 Position;
+  UINTN                  FileSize;
+  UINTN                  ReadSize;
+  VOID                   *Buffer;
+  UINT64                 StartTime;
+  UINT64                 Elapsed;
+
+  for (Index = 0; (Index < ARRAY_SIZE (FileName) - 1) && (Path[Index] != '\0'); ++Index) {
+    FileName[Index] = (CHAR16)Path[Index];
+  }
+
+  FileName[Index] = L'\0';
+
+  mImage = UserMapFile (ImageName, &mImageSize);
+  if (mImage == NULL) {
+    DEBUG ((DEBUG_ERROR, "Read fail\n"));
+    return -1;
+  }
+
+  ZeroMem (&DiskIo, sizeof (DiskIo));
+  ZeroMem (&BlockIo, sizeof (BlockIo));
+  ZeroMem (&Media, sizeof (Media));
+  DiskIo.ReadDisk = ImageReadDisk;
+  BlockIo.Media   = &Media;
+
+  Instance = AllocateZeroPool (sizeof (EFI_FS));
+  if (Instance == NULL) {
+    UserUnmapFile (mImage, mImageSize);
+    return -1;
+  }
+
+  Instance->DiskIo              = &DiskIo;
+  Instance->BlockIo             = &BlockIo;
+  Instance->EfiFile.Revision    = EFI_FILE_PROTOCOL_REVISION2;
+  Instance->EfiFile.Open        = FileOpen;
+  Instance->EfiFile.Close       = FileClose;
+  Instance->EfiFile.Delete      = FileDelete;
+  Instance->EfiFile.Read        = FileRead;
+  Instance->EfiFile.Write       = FileWrite;
+  Instance->EfiFile.GetPosition = FileGetPosition;
+  Instance->EfiFile.SetPosition = FileSetPosition;
+  Instance->EfiFile.GetInfo     = FileGetInfo;
+  Instance->EfiFile.SetInfo     = FileSetInfo;
+  Instance->EfiFile.Flush       = FileFlush;
+
+  Status = NtfsMount (Instance);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Mount fail - %r\n", Status));
+    FreeCache (Instance);
+    FreePool (Instance);
+    UserUnmapFile (mImage, mImageSize);
+    return -1;
+  }
+
+  Status = FileOpen ((EFI_FILE_PROTOCOL *)Instance->RootIndex->File, &NewHandle, FileName, EFI_FILE_MODE_READ, 0);
+  if (!EFI_ERROR (Status)) {
+    FileSetPosition (NewHandle, MAX_UINT64);
+    FileGetPosition (NewHandle, &Position);
+    FileSize = (UINTN)Position;
+    Buffer   = AllocatePool (FileSize);
+    Status   = (Buffer != NULL) ? EFI_SUCCESS : EFI_OUT_OF_RESOURCES;
+
+    StartTime = UserGetTimeUs ();
+    for (Index = 0; (Index < Iterations) && !EFI_ERROR (Status); ++Index) {
+      ReadSize = FileSize;
+      Status   = FileSetPosition (NewHandle, 0);
+      if (!EFI_ERROR (Status)) {
+        Status = FileRead (NewHandle, &ReadSize, Buffer);
+      }
+    }
+
+    Elapsed = UserGetTimeUs () - StartTime;
+
+    if (!EFI_ERROR (Status)) {
+      DEBUG ((
+        DEBUG_ERROR,
+        "Read %u bytes %u times in %Lu us (%Lu KB/s)\n",
+        (UINT32)FileSize,
+        Iterations,
+        Elapsed,
+        (Elapsed != 0) ? DivU64x64Remainder (MultU64x32 ((UINT64)FileSize, Iterations) * 1000000ULL / 1024ULL, Elapsed, NULL) : 0
+        ));
+    }
+
+    if (Buffer != NULL) {
+      FreePool (Buffer);
+    }
+
+    FileClose (NewHandle);
+  }
+
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Read %a fail - %r\n", Path, Status));
+  }
+
+  FreeAttr (&Instance->RootIndex->Attr);
+  FreeAttr (&Instance->MftStart->Attr);
+  FreePool (Instance->RootIndex->FileRecord);
+  FreePool (Instance->MftStart->FileRecord);
+  FreePool (Instance->RootIndex->File);
+  FreeCache (Instance);
+  FreePool (Instance);
+  UserUnmapFile (mImage, mImageSize);
+
+  return EFI_ERROR (Status) ? -1 : 0;
+}
+
 int
 ENTRY_POINT (
   int   argc,
@@ -246,6 +401,10 @@ ENTRY_POINT (
   uint32_t  f;
   uint8_t   *b;
 
+  if ((argc > 3) && (AsciiStrCmp (argv[1], "-b") == 0)) {
+    return BenchmarkFile (argv[2], argv[3], (argc > 4) ? (UINT32)AsciiStrDecimalToUintn (argv[4]) : 100);
+  }
+
   if ((b = UserReadFile ((argc > 1) ? argv[1] : "in.bin", &f)) == NULL) {
     DEBUG ((DEBUG_ERROR, "Read fail\n"));
     return -1;
@@ -24,6 +24,11 @@
 #include <Library/OcMainLib.h>
 
 #include <UserFile.h>
+#include <UserMisc.h>
+
+#ifndef _WIN32
+  #include <dirent.h>
+#endif
 
 #define  OC_USER_FULL_PATH_MAX_SIZE  256
 
@@ -80,8 +85,8 @@ STATIC UINT32   KernelVersion   = 0;
 
 STATIC EFI_FILE_PROTOCOL  NilFileProtocol;
 
-STATIC UINT8   *mPrelinked    = NULL;
-STATIC UINT32  mPrelinkedSize = 0;
+STATIC CONST UINT8  *mPrelinked    = NULL;
+STATIC UINT32       mPrelinkedSize = 0;
 
 //
 // TODO: Windows portability.
@@ -308,6 +313,160 @@ OcGetFileSize (
   return EFI_SUCCESS;
 }
 
+STATIC
+EFI_STATUS
+UserProcessKernel (
+  IN     CONST CHAR8       *FileName,
+  IN OUT OC_GLOBAL_CONFIG  *Config,
+  IN     UINT32            ReservedInfoSize,
+  IN     UINT32            ReservedExeSize,
+  IN     UINT32            LinkedExpansion,
+  IN     BOOLEAN           WriteOutput
+  )
+{
+  EFI_STATUS   Status;
+  UINT32       AllocSize;
+  UINT8        *NewPrelinked;
+  UINT32       NewPrelinkedSize;
+  UINT8        Sha384[48];
+  BOOLEAN      Is32Bit;
+  OC_CPU_INFO  DummyCpuInfo;
+
+  //
+  // Map the kernel to avoid an extra copy, ReadAppleKernel copies it anyway.
+  //
+  mPrelinked = UserMapFile (FileName, &mPrelinkedSize);
+  if (mPrelinked == NULL) {
+    DEBUG ((DEBUG_ERROR, "Read fail %a\n", FileName));
+    return EFI_NOT_FOUND;
+  }
+
+  Status = ReadAppleKernel (
+             &NilFileProtocol,
+             FALSE,
+             &Is32Bit,
+             &NewPrelinked,
+             &NewPrelinkedSize,
+             &AllocSize,
+             ReservedInfoSize + ReservedExeSize + LinkedExpansion,
+             Sha384
+             );
+
+  UserUnmapFile (mPrelinked, mPrelinkedSize);
+  mPrelinked     = NULL;
+  mPrelinkedSize = 0;
+
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_WARN, "[FAIL] Kernel unpack failure - %r\n", Status));
+    return Status;
+  }
+
+  DEBUG ((DEBUG_WARN, "[OK] Sha384 is %02X%02X%02X%02X\n", Sha384[0], Sha384[1], Sha384[2], Sha384[3]));
+
+  KernelVersion = OcKernelReadDarwinVersion (NewPrelinked, NewPrelinkedSize);
+  if (KernelVersion != 0) {
+    DEBUG ((DEBUG_WARN, "[OK] Got version %u\n", KernelVersion));
+  } else {
+    DEBUG ((DEBUG_WARN, "[FAIL] Failed to detect version\n"));
+    FailedToProcess = TRUE;
+  }
+
+  ZeroMem (&DummyCpuInfo, sizeof (DummyCpuInfo));
+
+  //
+  // Apply patches to kernel itself, and then process prelinked.
+  //
+  OcKernelApplyPatches (
+    Config,
+    &DummyCpuInfo,
+    KernelVersion,
+    FALSE,
+    CacheTypeNone,
+    NULL,
+    NewPrelinked,
+    NewPrelinkedSize
+    );
+  Status = OcKernelProcessPrelinked (
+             Config,
+             KernelVersion,
+             FALSE,
+             NewPrelinked,
+             &NewPrelinkedSize,
+             AllocSize,
+             LinkedExpansion,
+             ReservedExeSize
+             );
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_WARN, "[FAIL] Kernel process - %r\n", Status));
+    FreePool (NewPrelinked);
+    return Status;
+  }
+
+  DEBUG ((DEBUG_INFO, "OC: Prelinked status - %r\n", Status));
+
+  if (WriteOutput) {
+    UserWriteFile ("out.bin", NewPrelinked, NewPrelinkedSize);
+  }
+
+  FreePool (NewPrelinked);
+
+  return EFI_SUCCESS;
+}
+
+#ifndef _WIN32
+STATIC
+VOID
+UserProcessKernelDirectory (
+  IN     CONST CHAR8       *DirectoryName,
+  IN     DIR               *Directory,
+  IN OUT OC_GLOBAL_CONFIG  *Config,
+  IN     UINT32            ReservedInfoSize,
+  IN     UINT32            ReservedExeSize,
+  IN     UINT32            LinkedExpansion
+  )
+{
+  struct dirent  *Entry;
+  EFI_STATUS     Status;
+  CHAR8          FileName[OC_USER_FULL_PATH_MAX_SIZE];
+  UINT64         StartTime;
+  UINT64         TotalTime;
+  UINT32         Processed;
+  UINT32         Failed;
+
+  TotalTime = 0;
+  Processed = 0;
+  Failed    = 0;
+
+  while ((Entry = readdir (Directory)) != NULL) {
+    if (Entry->d_name[0] == '.') {
+      continue;
+    }
+
+    Status = OcAsciiSafeSPrint (FileName, sizeof (FileName), "%a/%a", DirectoryName, Entry->d_name);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_WARN, "Failed to fit kernel path %a/%a\n", DirectoryName, Entry->d_name));
+      continue;
+    }
+
+    StartTime  = UserGetTimeUs ();
+    Status     = UserProcessKernel (FileName, Config, ReservedInfoSize, ReservedExeSize, LinkedExpansion, FALSE);
+    StartTime  = UserGetTimeUs () - StartTime;
+    TotalTime += StartTime;
+    ++Processed;
+
+    if (EFI_ERROR (Status)) {
+      ++Failed;
+      FailedToProcess = TRUE;
+    }
+
+    DEBUG ((DEBUG_WARN, "[%a] %a - %Lu us\n", EFI_ERROR (Status) ? "FAIL" : "OK", Entry->d_name, StartTime));
+  }
+
+  DEBUG ((DEBUG_WARN, "Processed %u kernels (%u failed) in %Lu us\n", Processed, Failed, TotalTime));
+}
+
+#endif // !_WIN32
+
 int
 WrapMain (
   int   argc,
@@ -320,8 +479,9 @@ WrapMain (
   EFI_STATUS        Status;
   UINT32            ErrorCount;
   UINT32            Index;
-  UINT32            AllocSize;
-  EFI_STATUS        PrelinkedStatus;
+ #ifndef _WIN32
+  DIR               *Directory;
+ #endif
 
   CONST CHAR8  *FileName;
 
@@ -330,25 +490,15 @@ WrapMain (
   UINT32   ReservedExeSize;
   UINT32   NumReservedKexts;
   UINT32   LinkedExpansion;
-  UINT8    *NewPrelinked;
-  UINT32   NewPrelinkedSize;
-  UINT8    Sha384[48];
-  BOOLEAN  Is32Bit;
-
-  OC_CPU_INFO  DummyCpuInfo;
 
   OC_KERNEL_ADD_ENTRY  *Kext;
 
   if (argc < 2) {
-    DEBUG ((DEBUG_ERROR, "Usage: %a <path/to/OC/folder/> [path/to/kernel]\n\n", argv[0]));
+    DEBUG ((DEBUG_ERROR, "Usage: %a <path/to/OC/folder/> [path/to/kernel or path/to/kernel/folder]\n\n", argv[0]));
     return -1;
   }
 
   FileName = argc > 2 ? argv[2] : "/System/Library/PrelinkedKernels/prelinkedkernel";
-  if ((mPrelinked = UserReadFile (FileName, &mPrelinkedSize)) == NULL) {
-    DEBUG ((DEBUG_ERROR, "Read fail %a\n", FileName));
-    return -1;
-  }
 
   if (!UserSetRootPath (argv[1])) {
     return -1;
@@ -416,36 +566,6 @@ WrapMain (
     return -1;
   }
 
-  Status = ReadAppleKernel (
-             &NilFileProtocol,
-             FALSE,
-             &Is32Bit,
-             &NewPrelinked,
-             &NewPrelinkedSize,
-             &AllocSize,
-             ReservedInfoSize + ReservedExeSize + LinkedExpansion,
-             Sha384
-             );
-  if (!EFI_ERROR (Status)) {
-    FreePool (mPrelinked);
-    mPrelinked     = NewPrelinked;
-    mPrelinkedSize = NewPrelinkedSize;
-    DEBUG ((DEBUG_WARN, "[OK] Sha384 is %02X%02X%02X%02X\n", Sha384[0], Sha384[1], Sha384[2], Sha384[3]));
-  } else {
-    DEBUG ((DEBUG_WARN, "[FAIL] Kernel unpack failure - %r\n", Status));
-    FailedToProcess = TRUE;
-    return -1;
-  }
-
-  KernelVersion = OcKernelReadDarwinVersion (mPrelinked, mPrelinkedSize);
-  if (KernelVersion != 0) {
-    DEBUG ((DEBUG_WARN, "[OK] Got version %u\n", KernelVersion));
-  } else {
-    DEBUG ((DEBUG_WARN, "[FAIL] Failed to detect version\n"));
-    FailedToProcess = TRUE;
-  }
-
-  ZeroMem (&DummyCpuInfo, sizeof (DummyCpuInfo));
   //
   // Disable ProvideCurrentCpuInfo patch, as there is no CpuInfo available on userspace.
   //
@@ -460,39 +580,24 @@ WrapMain (
   ASSERT (Config.Kernel.Force.Count == 0);
 
   //
-  // Apply patches to kernel itself, and then process prelinked.
+  // Process every kernel in the directory when one is passed, reusing the
+  // loaded config and kexts, and report per-kernel timings.
   //
-  OcKernelApplyPatches (
-    &Config,
-    &DummyCpuInfo,
-    KernelVersion,
-    FALSE,
-    CacheTypeNone,
-    NULL,
-    NewPrelinked,
-    NewPrelinkedSize
-    );
-  PrelinkedStatus = OcKernelProcessPrelinked (
-                      &Config,
-                      KernelVersion,
-                      FALSE,
-                      NewPrelinked,
-                      &NewPrelinkedSize,
-                      AllocSize,
-                      LinkedExpansion,
-                      ReservedExeSize
-                      );
-  if (EFI_ERROR (PrelinkedStatus)) {
-    DEBUG ((DEBUG_WARN, "[FAIL] Kernel process - %r\n", PrelinkedStatus));
-    FailedToProcess = TRUE;
-    return -1;
+ #ifndef _WIN32
+  Directory = opendir (FileName);
+  if (Directory != NULL) {
+    UserProcessKernelDirectory (FileName, Directory, &Config, ReservedInfoSize, ReservedExeSize, LinkedExpansion);
+    closedir (Directory);
+    return FailedToProcess ? -1 : 0;
   }
 
-  DEBUG ((DEBUG_INFO, "OC: Prelinked status - %r\n", PrelinkedStatus));
-
-  UserWriteFile ("out.bin", NewPrelinked, NewPrelinkedSize);
+ #endif // !_WIN32
 
-  FreePool (mPrelinked);
+  Status = UserProcessKernel (FileName, &Config, ReservedInfoSize, ReservedExeSize, LinkedExpansion, TRUE);
+  if (EFI_ERROR (Status)) {
+    FailedToProcess = TRUE;
+    return -1;
+  }
 
   return 0;
 }
@@ -13,6 +13,7 @@
 **/
 
 #include <UserFile.h>
+#include <UserMisc.h>
 
 #include <Library/OcCryptoLib.h>
 #include <Library/OcAppleKeysLib.h>
@@ -36,8 +37,15 @@ VerifyRsa (
 
   if ((RSqrMod == NULL) || (Scratch == NULL)) {
     DEBUG ((DEBUG_ERROR, "memory allocation error!\n"));
-    FreePool (RSqrMod);
-    FreePool (Scratch);
+    if (RSqrMod != NULL) {
+      FreePool (RSqrMod);
+    }
+
+    if (Scratch != NULL) {
+      FreePool (Scratch);
+    }
+
+    return;
   }
 
   N0Inv = BigNumCalculateMontParams (
@@ -65,6 +73,157 @@ VerifyRsa (
   FreePool (RSqrMod);
 }
 
+/**
+  Creates a public key with a random odd modulus of the requested size.
+  It has no matching private key, but the verification cost does not
+  depend on the signature being valid.
+**/
+STATIC
+OC_RSA_PUBLIC_KEY *
+CreateBenchmarkKey (
+  IN UINT32  NumQwords
+  )
+{
+  OC_RSA_PUBLIC_KEY  *PublicKey;
+  OC_BN_WORD         *Scratch;
+  UINT32             State;
+  UINT32             Index;
+
+  PublicKey = AllocatePool (sizeof (PublicKey->Hdr) + 2 * NumQwords * sizeof (UINT64));
+  Scratch   = AllocatePool (BIG_NUM_MONT_PARAMS_SCRATCH_SIZE (NumQwords * sizeof (UINT64) / OC_BN_WORD_SIZE));
+  if ((PublicKey == NULL) || (Scratch == NULL)) {
+    DEBUG ((DEBUG_ERROR, "memory allocation error!\n"));
+    if (PublicKey != NULL) {
+      FreePool (PublicKey);
+    }
+
+    if (Scratch != NULL) {
+      FreePool (Scratch);
+    }
+
+    return NULL;
+  }
+
+  State = 0x52534131U;
+  for (Index = 0; Index < NumQwords; ++Index) {
+    PublicKey->Data[Index] = LShiftU64 (UserPseudoRandom (&State), 32) | UserPseudoRandom (&State);
+  }
+
+  PublicKey->Data[0]             |= 1U;
+  PublicKey->Data[NumQwords - 1] |= BIT63;
+
+  PublicKey->Hdr.NumQwords = NumQwords;
+  PublicKey->Hdr.N0Inv     = BigNumCalculateMontParams (
+                               (OC_BN_WORD *)&PublicKey->Data[NumQwords],
+                               (OC_BN_NUM_WORDS)(NumQwords * sizeof (UINT64) / OC_BN_WORD_SIZE),
+                               (CONST OC_BN_WORD *)PublicKey->Data,
+                               Scratch
+                               );
+
+  FreePool (Scratch);
+  return PublicKey;
+}
+
+STATIC
+VOID
+BenchmarkRsa (
+  IN CONST OC_RSA_PUBLIC_KEY  *PublicKey,
+  IN UINT32                   Iterations
+  )
+{
+  UINTN   ModulusSize;
+  UINT8   *Signature;
+  VOID    *Scratch;
+  UINT8   Hash[SHA256_DIGEST_SIZE];
+  UINT32  State;
+  UINT32  Index;
+  UINT32  Verified;
+  UINT64  StartTime;
+  UINT64  Elapsed;
+
+  ModulusSize = PublicKey->Hdr.NumQwords * sizeof (UINT64);
+  Signature   = AllocatePool (ModulusSize);
+  Scratch     = AllocatePool (RSA_SCRATCH_BUFFER_SIZE (ModulusSize));
+  if ((Signature == NULL) || (Scratch == NULL)) {
+    DEBUG ((DEBUG_ERROR, "memory allocation error!\n"));
+    if (Signature != NULL) {
+      FreePool (Signature);
+    }
+
+    if (Scratch != NULL) {
+      FreePool (Scratch);
+    }
+
+    return;
+  }
+
+  //
+  // Keep the signature below the modulus by clearing its most significant
+  // byte. The signature is stored in big endian.
+  //
+  State = 0x53494731U;
+  for (Index = 0; Index < ModulusSize; ++Index) {
+    Signature[Index] = (UINT8)(UserPseudoRandom (&State) >> 24U);
+  }
+
+  Signature[0] = 0;
+  ZeroMem (Hash, sizeof (Hash));
+
+  Verified  = 0;
+  StartTime = UserGetTimeUs ();
+  for (Index = 0; Index < Iterations; ++Index) {
+    if (RsaVerifySigHashFromKey (
+          PublicKey,
+          Signature,
+          ModulusSize,
+          Hash,
+          sizeof (Hash),
+          OcSigHashTypeSha256,
+          Scratch
+          ))
+    {
+      ++Verified;
+    }
+
+    ++Signature[ModulusSize - 1];
+  }
+
+  Elapsed = MAX (UserGetTimeUs () - StartTime, 1);
+
+  DEBUG ((
+    DEBUG_ERROR,
+    "RSA-%u: %u verifications in %Lu us, %Lu/s (%u valid)\n",
+    (UINT32)(ModulusSize * OC_CHAR_BIT),
+    Iterations,
+    Elapsed,
+    DivU64x64Remainder (MultU64x32 (1000000ULL, Iterations), Elapsed, NULL),
+    Verified
+    ));
+
+  FreePool (Scratch);
+  FreePool (Signature);
+}
+
+STATIC
+INT32
+Benchmark (
+  IN UINT32  Iterations
+  )
+{
+  OC_RSA_PUBLIC_KEY  *PublicKey;
+
+  BenchmarkRsa (PkDataBase[0].PublicKey, Iterations);
+
+  PublicKey = CreateBenchmarkKey (4096 / 64);
+  if (PublicKey == NULL) {
+    return -1;
+  }
+
+  BenchmarkRsa (PublicKey, Iterations);
+  FreePool (PublicKey);
+  return 0;
+}
+
 int
 ENTRY_POINT (
   int   argc,
@@ -75,6 +234,10 @@ ENTRY_POINT (
   OC_RSA_PUBLIC_KEY  *PublicKey;
   UINT32             PkSize;
 
+  if ((argc > 1) && (AsciiStrCmp (argv[1], "-b") == 0)) {
+    return Benchmark ((argc > 2) ? (UINT32)AsciiStrDecimalToUintn (argv[2]) : 1000);
+  }
+
   for (Index = 1; Index < argc; ++Index) {
     PublicKey = (OC_RSA_PUBLIC_KEY *)UserReadFile (argv[Index], &PkSize);
     if (PublicKey == NULL) {